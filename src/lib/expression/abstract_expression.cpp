@@ -0,0 +1,43 @@
+#include "abstract_expression.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractExpression::AbstractExpression(const ExpressionType type,
+                                       const std::vector<std::shared_ptr<AbstractExpression>>& arguments)
+    : _type(type), _arguments(arguments) {
+  for (const auto& argument : arguments) {
+    Assert(argument != nullptr, "Arguments of expressions must be defined.");
+  }
+}
+
+ExpressionType AbstractExpression::type() const { return _type; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& AbstractExpression::arguments() const { return _arguments; }
+
+std::string AbstractExpression::_argument_description(const size_t argument_index, const Table& input_table) const {
+  const auto& argument = *_arguments[argument_index];
+  if (argument.type() == ExpressionType::Column || argument.type() == ExpressionType::Value) {
+    return argument.description(input_table);
+  }
+  return "(" + argument.description(input_table) + ")";
+}
+
+std::string AbstractExpression::_common_numeric_data_type(const std::string& lhs, const std::string& rhs) {
+  // ordered by precedence
+  static const auto numeric_data_types = std::vector<std::string>{"int", "long", "float", "double"};
+
+  const auto lhs_iter = std::find(numeric_data_types.cbegin(), numeric_data_types.cend(), lhs);
+  const auto rhs_iter = std::find(numeric_data_types.cbegin(), numeric_data_types.cend(), rhs);
+  Assert(lhs_iter != numeric_data_types.cend() && rhs_iter != numeric_data_types.cend(),
+         "Expected numeric data types, got " + lhs + " and " + rhs + ".");
+  return *std::max(lhs_iter, rhs_iter);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ExpressionType { Column, Value, Arithmetic, Comparison, Cast, Case };
+
+/**
+ * Base class of all expressions. An expression computes one value per row of a table, e.g., price * (1 - discount).
+ * Expressions form trees whose leaves are columns and values. They are evaluated chunk by chunk by the
+ * ExpressionEvaluator.
+ *
+ * As the data type of an expression depends on the data types of the columns it uses, it is derived from the table the
+ * expression is evaluated on.
+ */
+class AbstractExpression : private Noncopyable {
+ public:
+  AbstractExpression(const ExpressionType type, const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
+  virtual ~AbstractExpression() = default;
+
+  ExpressionType type() const;
+  const std::vector<std::shared_ptr<AbstractExpression>>& arguments() const;
+
+  // returns the data type ("int", "long", ...) of the values computed for the rows of input_table
+  virtual std::string data_type(const Table& input_table) const = 0;
+
+  // returns a human-readable representation, e.g., "price * (1 - discount)", which names the output columns
+  virtual std::string description(const Table& input_table) const = 0;
+
+ protected:
+  // returns the description of an argument, in parentheses if it is not a column or value
+  std::string _argument_description(const size_t argument_index, const Table& input_table) const;
+
+  // Returns the type two numbers are converted to when they are combined, e.g., "long" for "int" and "long". Fails for
+  // strings.
+  static std::string _common_numeric_data_type(const std::string& lhs, const std::string& rhs);
+
+  const ExpressionType _type;
+  const std::vector<std::shared_ptr<AbstractExpression>> _arguments;
+};
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include "arithmetic_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                                           const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Arithmetic, {left, right}), _arithmetic_operator(arithmetic_operator) {}
+
+ArithmeticOperator ArithmeticExpression::arithmetic_operator() const { return _arithmetic_operator; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::left() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::right() const { return _arguments[1]; }
+
+std::string ArithmeticExpression::data_type(const Table& input_table) const {
+  return _common_numeric_data_type(left()->data_type(input_table), right()->data_type(input_table));
+}
+
+std::string ArithmeticExpression::description(const Table& input_table) const {
+  auto operator_string = std::string{};
+  switch (_arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+    case ArithmeticOperator::Modulo:
+      operator_string = " % ";
+      break;
+  }
+  return _argument_description(0, input_table) + operator_string + _argument_description(1, input_table);
+}
+
+}  // namespace opossum
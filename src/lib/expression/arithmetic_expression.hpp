@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division, Modulo };
+
+/**
+ * Combines two numbers. Both arguments are converted to their common type first, e.g., an int and a float are added as
+ * floats. As there are no NULLs, an integral division or modulo by zero fails.
+ */
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator arithmetic_operator, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ArithmeticOperator arithmetic_operator() const;
+  const std::shared_ptr<AbstractExpression>& left() const;
+  const std::shared_ptr<AbstractExpression>& right() const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+
+ protected:
+  const ArithmeticOperator _arithmetic_operator;
+};
+
+}  // namespace opossum
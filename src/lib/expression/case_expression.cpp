@@ -0,0 +1,35 @@
+#include "case_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CaseExpression::CaseExpression(const std::shared_ptr<AbstractExpression>& condition,
+                               const std::shared_ptr<AbstractExpression>& then_expression,
+                               const std::shared_ptr<AbstractExpression>& else_expression)
+    : AbstractExpression(ExpressionType::Case, {condition, then_expression, else_expression}) {}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::condition() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::then_expression() const { return _arguments[1]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::else_expression() const { return _arguments[2]; }
+
+std::string CaseExpression::data_type(const Table& input_table) const {
+  Assert(condition()->data_type(input_table) != "string", "The condition of CASE must be a number.");
+
+  const auto then_data_type = then_expression()->data_type(input_table);
+  const auto else_data_type = else_expression()->data_type(input_table);
+  if (then_data_type == "string" && else_data_type == "string") return "string";
+  return _common_numeric_data_type(then_data_type, else_data_type);
+}
+
+std::string CaseExpression::description(const Table& input_table) const {
+  return "CASE WHEN " + condition()->description(input_table) + " THEN " + then_expression()->description(input_table) +
+         " ELSE " + else_expression()->description(input_table) + " END";
+}
+
+}  // namespace opossum
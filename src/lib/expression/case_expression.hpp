@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+/**
+ * CASE WHEN condition THEN then_expression ELSE else_expression END. The condition holds for rows where it is not 0.
+ * Nested CASE expressions in else_expression express multiple WHEN clauses. The results of then_expression and
+ * else_expression have to be both numbers (which are converted to their common type) or both strings.
+ *
+ * then_expression is only evaluated for the rows for which the condition holds, and else_expression only for the other
+ * rows. Thus, CASE WHEN b <> 0 THEN a / b ELSE 0 END does not fail for rows where b is 0.
+ */
+class CaseExpression : public AbstractExpression {
+ public:
+  CaseExpression(const std::shared_ptr<AbstractExpression>& condition,
+                 const std::shared_ptr<AbstractExpression>& then_expression,
+                 const std::shared_ptr<AbstractExpression>& else_expression);
+
+  const std::shared_ptr<AbstractExpression>& condition() const;
+  const std::shared_ptr<AbstractExpression>& then_expression() const;
+  const std::shared_ptr<AbstractExpression>& else_expression() const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+};
+
+}  // namespace opossum
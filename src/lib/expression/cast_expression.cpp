@@ -0,0 +1,20 @@
+#include "cast_expression.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+CastExpression::CastExpression(const std::shared_ptr<AbstractExpression>& argument,
+                               const std::string& target_data_type)
+    : AbstractExpression(ExpressionType::Cast, {argument}), _target_data_type(target_data_type) {}
+
+const std::shared_ptr<AbstractExpression>& CastExpression::argument() const { return _arguments[0]; }
+
+std::string CastExpression::data_type(const Table&) const { return _target_data_type; }
+
+std::string CastExpression::description(const Table& input_table) const {
+  return "CAST(" + argument()->description(input_table) + " AS " + _target_data_type + ")";
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Converts the values of its argument to another data type. Numbers are converted like by static_cast. Conversions
+ * from and to strings use the same rules as type_cast.
+ */
+class CastExpression : public AbstractExpression {
+ public:
+  CastExpression(const std::shared_ptr<AbstractExpression>& argument, const std::string& target_data_type);
+
+  const std::shared_ptr<AbstractExpression>& argument() const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+
+ protected:
+  const std::string _target_data_type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include "column_expression.hpp"
+
+#include <string>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ColumnExpression::ColumnExpression(const ColumnID column_id)
+    : AbstractExpression(ExpressionType::Column, {}), _column_id(column_id) {}
+
+ColumnID ColumnExpression::column_id() const { return _column_id; }
+
+std::string ColumnExpression::data_type(const Table& input_table) const {
+  Assert(_column_id < input_table.column_count(), "Column does not exist.");
+  return input_table.column_type(_column_id);
+}
+
+std::string ColumnExpression::description(const Table& input_table) const {
+  Assert(_column_id < input_table.column_count(), "Column does not exist.");
+  return input_table.column_name(_column_id);
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The values of a column of the input table
+class ColumnExpression : public AbstractExpression {
+ public:
+  explicit ColumnExpression(const ColumnID column_id);
+
+  ColumnID column_id() const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include "comparison_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ComparisonExpression::ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Comparison, {left, right}), _scan_type(scan_type) {}
+
+ScanType ComparisonExpression::scan_type() const { return _scan_type; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::left() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::right() const { return _arguments[1]; }
+
+std::string ComparisonExpression::compared_data_type(const Table& input_table) const {
+  const auto left_data_type = left()->data_type(input_table);
+  const auto right_data_type = right()->data_type(input_table);
+  if (left_data_type == "string" && right_data_type == "string") return "string";
+
+  // fails if only one of them is a string
+  return _common_numeric_data_type(left_data_type, right_data_type);
+}
+
+std::string ComparisonExpression::data_type(const Table& input_table) const {
+  compared_data_type(input_table);
+  return "int";
+}
+
+std::string ComparisonExpression::description(const Table& input_table) const {
+  auto operator_string = std::string{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      operator_string = " = ";
+      break;
+    case ScanType::OpNotEquals:
+      operator_string = " <> ";
+      break;
+    case ScanType::OpLessThan:
+      operator_string = " < ";
+      break;
+    case ScanType::OpLessThanEquals:
+      operator_string = " <= ";
+      break;
+    case ScanType::OpGreaterThan:
+      operator_string = " > ";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      operator_string = " >= ";
+      break;
+  }
+  return _argument_description(0, input_table) + operator_string + _argument_description(1, input_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Compares two numbers or two strings and returns 1 (an int) if the comparison holds and 0 otherwise. Numbers are
+ * compared in their common type. Comparing a number with a string fails.
+ */
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ScanType scan_type() const;
+  const std::shared_ptr<AbstractExpression>& left() const;
+  const std::shared_ptr<AbstractExpression>& right() const;
+
+  // returns the data type both arguments are converted to before they are compared
+  std::string compared_data_type(const Table& input_table) const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+
+ protected:
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
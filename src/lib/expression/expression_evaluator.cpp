@@ -0,0 +1,357 @@
+#include "expression_evaluator.hpp"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arithmetic_expression.hpp"
+#include "case_expression.hpp"
+#include "cast_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "value_expression.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct ConstantAccess {
+  const T& operator()(const size_t) const { return value; }
+  const T& value;
+};
+
+template <typename T>
+struct VectorAccess {
+  const T& operator()(const size_t index) const { return values[index]; }
+  const T* values;
+};
+
+// Calls functor with an accessor for the values of result. This way, loops over the values of constant and
+// non-constant results are instantiated separately, and the loops over non-constant results do not contain branches.
+template <typename T, typename Functor>
+void resolve_access(const ExpressionResult<T>& result, const Functor& functor) {
+  if (result.is_constant) {
+    functor(ConstantAccess<T>{result.data()[0]});
+  } else {
+    functor(VectorAccess<T>{result.data()});
+  }
+}
+
+// Converts the values of source to T. Numbers are converted by static_cast, strings by type_cast.
+template <typename T, typename SourceType>
+ExpressionResult<T> convert_result(ExpressionResult<SourceType>&& source) {
+  if constexpr (std::is_same_v<T, SourceType>) {
+    return std::move(source);
+  } else {
+    auto result = ExpressionResult<T>{};
+    result.is_constant = source.is_constant;
+    result.values.resize(source.size());
+
+    const auto* source_values = source.data();
+    for (auto index = size_t{0}; index < result.values.size(); ++index) {
+      if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<SourceType>) {
+        result.values[index] = static_cast<T>(source_values[index]);
+      } else {
+        result.values[index] = type_cast<T>(AllTypeVariant{source_values[index]});
+      }
+    }
+    return result;
+  }
+}
+
+template <typename T, typename LeftAccess, typename RightAccess>
+void apply_arithmetic(const ArithmeticOperator arithmetic_operator, const LeftAccess& left, const RightAccess& right,
+                      std::vector<T>& values) {
+  const auto size = values.size();
+
+  if constexpr (std::is_integral_v<T>) {
+    if (arithmetic_operator == ArithmeticOperator::Division || arithmetic_operator == ArithmeticOperator::Modulo) {
+      for (auto index = size_t{0}; index < size; ++index) {
+        Assert(right(index) != 0, "Division by zero.");
+        // The quotient of the smallest value and -1 does not fit into T (and traps on x86, also for the remainder)
+        if constexpr (std::is_signed_v<T>) {
+          Assert(right(index) != -1 || left(index) != std::numeric_limits<T>::min(), "Integer overflow in division.");
+        }
+      }
+    }
+  }
+
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      for (auto index = size_t{0}; index < size; ++index) values[index] = left(index) + right(index);
+      return;
+    case ArithmeticOperator::Subtraction:
+      for (auto index = size_t{0}; index < size; ++index) values[index] = left(index) - right(index);
+      return;
+    case ArithmeticOperator::Multiplication:
+      for (auto index = size_t{0}; index < size; ++index) values[index] = left(index) * right(index);
+      return;
+    case ArithmeticOperator::Division:
+      for (auto index = size_t{0}; index < size; ++index) values[index] = left(index) / right(index);
+      return;
+    case ArithmeticOperator::Modulo:
+      for (auto index = size_t{0}; index < size; ++index) {
+        if constexpr (std::is_integral_v<T>) {
+          values[index] = left(index) % right(index);
+        } else {
+          values[index] = std::fmod(left(index), right(index));
+        }
+      }
+      return;
+  }
+  Fail("Unknown arithmetic operator.");
+}
+
+template <typename T, typename LeftAccess, typename RightAccess>
+void apply_comparison(const ScanType scan_type, const LeftAccess& left, const RightAccess& right,
+                      std::vector<int32_t>& values) {
+  const auto compare = [&](const auto& comparator) {
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      values[index] = comparator(left(index), right(index));
+    }
+  };
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      compare([](const T& lhs, const T& rhs) { return lhs == rhs; });
+      return;
+    case ScanType::OpNotEquals:
+      compare([](const T& lhs, const T& rhs) { return lhs != rhs; });
+      return;
+    case ScanType::OpLessThan:
+      compare([](const T& lhs, const T& rhs) { return lhs < rhs; });
+      return;
+    case ScanType::OpLessThanEquals:
+      compare([](const T& lhs, const T& rhs) { return lhs <= rhs; });
+      return;
+    case ScanType::OpGreaterThan:
+      compare([](const T& lhs, const T& rhs) { return lhs > rhs; });
+      return;
+    case ScanType::OpGreaterThanEquals:
+      compare([](const T& lhs, const T& rhs) { return lhs >= rhs; });
+      return;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+}  // namespace
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id)
+    : _table(table), _chunk_id(chunk_id) {}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression) const {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+
+    auto result = _evaluate<ExpressionDataType>(expression, nullptr);
+    auto values = std::vector<ExpressionDataType>{};
+    if (result.is_constant) {
+      values.resize(_row_count(nullptr), result.values.front());
+    } else if (result.referenced_values) {
+      values = *result.referenced_values;
+    } else {
+      values = std::move(result.values);
+    }
+    segment = std::make_shared<ValueSegment<ExpressionDataType>>(std::move(values));
+  });
+  return segment;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate(const AbstractExpression& expression,
+                                                   const std::vector<ChunkOffset>* rows) const {
+  switch (expression.type()) {
+    case ExpressionType::Column:
+      return _evaluate_column<T>(static_cast<const ColumnExpression&>(expression), rows);
+    case ExpressionType::Value: {
+      auto result = ExpressionResult<T>{};
+      result.values.emplace_back(type_cast<T>(static_cast<const ValueExpression&>(expression).value()));
+      result.is_constant = true;
+      return result;
+    }
+    case ExpressionType::Arithmetic:
+      return _evaluate_arithmetic<T>(static_cast<const ArithmeticExpression&>(expression), rows);
+    case ExpressionType::Comparison:
+      if constexpr (std::is_same_v<T, int32_t>) {
+        return _evaluate_comparison(static_cast<const ComparisonExpression&>(expression), rows);
+      }
+      break;
+    case ExpressionType::Cast:
+      return _evaluate_as<T>(*static_cast<const CastExpression&>(expression).argument(), rows);
+    case ExpressionType::Case:
+      return _evaluate_case<T>(static_cast<const CaseExpression&>(expression), rows);
+  }
+  Fail("Expression cannot be evaluated to the requested data type.");
+  return {};
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_as(const AbstractExpression& expression,
+                                                      const std::vector<ChunkOffset>* rows) const {
+  auto result = ExpressionResult<T>{};
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+    result = convert_result<T>(_evaluate<ExpressionDataType>(expression, rows));
+  });
+  return result;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_column(const ColumnExpression& expression,
+                                                          const std::vector<ChunkOffset>* rows) const {
+  const auto segment = _table->get_chunk(_chunk_id).get_segment(expression.column_id());
+  auto result = ExpressionResult<T>{};
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(segment.get())) {
+    const auto& values = value_segment->values();
+    if (!rows) {
+      result.referenced_values = &values;
+      return result;
+    }
+
+    result.values.reserve(rows->size());
+    for (const auto chunk_offset : *rows) {
+      result.values.emplace_back(values[chunk_offset]);
+    }
+    return result;
+  }
+
+  const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(segment.get());
+  if (dictionary_segment && rows) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      result.values.reserve(rows->size());
+      for (const auto chunk_offset : *rows) {
+        result.values.emplace_back(dictionary[value_ids[chunk_offset]]);
+      }
+    });
+    return result;
+  }
+
+  // Materialize all values of the segment, then pick the requested rows
+  auto values = std::vector<T>(segment->size());
+  segment_iterate<T>(*segment, [&](const auto& position) { values[position.chunk_offset()] = position.value(); });
+  if (!rows) {
+    result.values = std::move(values);
+    return result;
+  }
+
+  result.values.reserve(rows->size());
+  for (const auto chunk_offset : *rows) {
+    result.values.emplace_back(std::move(values[chunk_offset]));
+  }
+  return result;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_arithmetic(const ArithmeticExpression& expression,
+                                                              const std::vector<ChunkOffset>* rows) const {
+  auto result = ExpressionResult<T>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    Fail("Arithmetic is not defined for strings.");
+  } else {
+    // Both arguments are converted to the data type of the result, which is their common type
+    const auto left = _evaluate_as<T>(*expression.left(), rows);
+    const auto right = _evaluate_as<T>(*expression.right(), rows);
+
+    result.is_constant = left.is_constant && right.is_constant;
+    result.values.resize(result.is_constant ? 1 : _row_count(rows));
+    resolve_access(left, [&](const auto& left_access) {
+      resolve_access(right, [&](const auto& right_access) {
+        apply_arithmetic(expression.arithmetic_operator(), left_access, right_access, result.values);
+      });
+    });
+  }
+  return result;
+}
+
+ExpressionResult<int32_t> ExpressionEvaluator::_evaluate_comparison(const ComparisonExpression& expression,
+                                                                    const std::vector<ChunkOffset>* rows) const {
+  auto result = ExpressionResult<int32_t>{};
+  const auto compare = [&](auto type) {
+    using ComparedType = typename decltype(type)::type;
+    const auto left = _evaluate_as<ComparedType>(*expression.left(), rows);
+    const auto right = _evaluate_as<ComparedType>(*expression.right(), rows);
+
+    result.is_constant = left.is_constant && right.is_constant;
+    result.values.resize(result.is_constant ? 1 : _row_count(rows));
+    resolve_access(left, [&](const auto& left_access) {
+      resolve_access(right, [&](const auto& right_access) {
+        apply_comparison<ComparedType>(expression.scan_type(), left_access, right_access, result.values);
+      });
+    });
+  };
+
+  resolve_data_type(expression.compared_data_type(*_table), compare);
+  return result;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_case(const CaseExpression& expression,
+                                                        const std::vector<ChunkOffset>* rows) const {
+  const auto condition = _evaluate_as<double>(*expression.condition(), rows);
+  const auto row_count = _row_count(rows);
+
+  // The condition might reference the values of a ValueSegment instead of holding its own values
+  const auto* condition_values = condition.data();
+
+  // A constant condition selects one of the expressions for all rows
+  if (condition.is_constant) {
+    const auto& selected_expression = condition_values[0] != 0 ? expression.then_expression()
+                                                               : expression.else_expression();
+    return _evaluate_as<T>(*selected_expression, rows);
+  }
+
+  // Evaluate then_expression only for the rows that satisfy the condition, and else_expression for the other rows
+  auto then_indices = std::vector<size_t>{};
+  auto else_indices = std::vector<size_t>{};
+  auto then_rows = std::vector<ChunkOffset>{};
+  auto else_rows = std::vector<ChunkOffset>{};
+  for (auto index = size_t{0}; index < row_count; ++index) {
+    const auto chunk_offset = rows ? (*rows)[index] : static_cast<ChunkOffset>(index);
+    if (condition_values[index] != 0) {
+      then_indices.emplace_back(index);
+      then_rows.emplace_back(chunk_offset);
+    } else {
+      else_indices.emplace_back(index);
+      else_rows.emplace_back(chunk_offset);
+    }
+  }
+
+  auto result = ExpressionResult<T>{};
+  result.values.resize(row_count);
+  const auto scatter = [&](const AbstractExpression& branch, const std::vector<size_t>& indices,
+                           const std::vector<ChunkOffset>& branch_rows) {
+    if (indices.empty()) return;
+    auto branch_result = _evaluate_as<T>(branch, &branch_rows);
+    resolve_access(branch_result, [&](const auto& access) {
+      for (auto index = size_t{0}; index < indices.size(); ++index) {
+        result.values[indices[index]] = access(index);
+      }
+    });
+  };
+  scatter(*expression.then_expression(), then_indices, then_rows);
+  scatter(*expression.else_expression(), else_indices, else_rows);
+  return result;
+}
+
+size_t ExpressionEvaluator::_row_count(const std::vector<ChunkOffset>* rows) const {
+  return rows ? rows->size() : _table->get_chunk(_chunk_id).size();
+}
+
+}  // namespace opossum
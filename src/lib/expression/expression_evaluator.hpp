@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class ArithmeticExpression;
+class BaseSegment;
+class CaseExpression;
+class ColumnExpression;
+class ComparisonExpression;
+class Table;
+
+// The values of an expression for a number of rows, or a single value that holds for all rows
+template <typename T>
+struct ExpressionResult {
+  const T* data() const { return referenced_values ? referenced_values->data() : values.data(); }
+  size_t size() const { return referenced_values ? referenced_values->size() : values.size(); }
+
+  std::vector<T> values;
+
+  // Set instead of values if the values are those of a ValueSegment, which avoids copying them
+  const std::vector<T>* referenced_values{nullptr};
+
+  // true if the result consists of a single value that holds for all rows
+  bool is_constant{false};
+};
+
+/**
+ * Evaluates expressions for the rows of one chunk. Instead of computing the value of an expression row by row using
+ * AllTypeVariants, the values of all rows are computed at once into a std::vector of the data type of the expression.
+ * The data types of all arguments are resolved once per chunk, so that there is a separate loop for each combination of
+ * argument types and of constant and non-constant arguments. These loops only contain the actual computation and are
+ * vectorized by the compiler where possible.
+ */
+class ExpressionEvaluator {
+ public:
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+  // computes the values of expression for all rows of the chunk
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression) const;
+
+ protected:
+  // Computes the values of expression for the given chunk offsets, or for all rows of the chunk if rows is nullptr.
+  // T has to be the data type of the expression.
+  template <typename T>
+  ExpressionResult<T> _evaluate(const AbstractExpression& expression, const std::vector<ChunkOffset>* rows) const;
+
+  // same as _evaluate, but converts the values from the data type of the expression to T if necessary, which is also
+  // used to evaluate CastExpressions
+  template <typename T>
+  ExpressionResult<T> _evaluate_as(const AbstractExpression& expression, const std::vector<ChunkOffset>* rows) const;
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_column(const ColumnExpression& expression, const std::vector<ChunkOffset>* rows) const;
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_arithmetic(const ArithmeticExpression& expression,
+                                           const std::vector<ChunkOffset>* rows) const;
+
+  ExpressionResult<int32_t> _evaluate_comparison(const ComparisonExpression& expression,
+                                                 const std::vector<ChunkOffset>* rows) const;
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_case(const CaseExpression& expression, const std::vector<ChunkOffset>* rows) const;
+
+  size_t _row_count(const std::vector<ChunkOffset>* rows) const;
+
+  const std::shared_ptr<const Table> _table;
+  const ChunkID _chunk_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#include "value_expression.hpp"
+
+#include <string>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+ValueExpression::ValueExpression(const AllTypeVariant& value)
+    : AbstractExpression(ExpressionType::Value, {}), _value(value) {}
+
+const AllTypeVariant& ValueExpression::value() const { return _value; }
+
+std::string ValueExpression::data_type(const Table&) const {
+  auto data_type = std::string{};
+  hana::for_each(data_types, [&](auto type_pair) {
+    using DataType = typename decltype(+hana::second(type_pair))::type;
+    if (_value.type() == typeid(DataType)) data_type = hana::first(type_pair);
+  });
+  return data_type;
+}
+
+std::string ValueExpression::description(const Table& input_table) const {
+  if (data_type(input_table) == "string") return "'" + type_cast<std::string>(_value) + "'";
+  return type_cast<std::string>(_value);
+}
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// A constant, which has the same value for all rows
+class ValueExpression : public AbstractExpression {
+ public:
+  explicit ValueExpression(const AllTypeVariant& value);
+
+  const AllTypeVariant& value() const;
+
+  std::string data_type(const Table& input_table) const override;
+  std::string description(const Table& input_table) const override;
+
+ protected:
+  const AllTypeVariant _value;
+};
+
+}  // namespace opossum
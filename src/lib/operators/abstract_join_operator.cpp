@@ -0,0 +1,73 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _column_ids(column_ids), _scan_type(scan_type) {
+  Assert(left != nullptr, "Left input operator must be defined.");
+  Assert(right != nullptr, "Right input operator must be defined.");
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals:
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      return;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+std::shared_ptr<Table> AbstractJoinOperator::_create_output_table(
+    const std::vector<std::shared_ptr<const PosList>>& left_pos_lists,
+    const std::vector<std::shared_ptr<const PosList>>& right_pos_lists) const {
+  DebugAssert(left_pos_lists.size() == right_pos_lists.size(), "Expected one right PosList per left PosList.");
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& input_table : {left_table, right_table}) {
+    for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+      output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+    }
+  }
+
+  for (auto index = size_t{0}; index < left_pos_lists.size(); ++index) {
+    DebugAssert(left_pos_lists[index]->size() == right_pos_lists[index]->size(), "Joined PosLists differ in size.");
+    if (left_pos_lists[index]->empty()) continue;
+
+    Chunk chunk;
+    write_output_segments(chunk, left_table, left_pos_lists[index]);
+    write_output_segments(chunk, right_table, right_pos_lists[index]);
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  // In case no rows were joined, create one chunk with empty segments
+  if (output_table->row_count() == 0) {
+    const auto empty_pos_list = std::make_shared<const PosList>();
+    Chunk chunk;
+    write_output_segments(chunk, left_table, empty_pos_list);
+    write_output_segments(chunk, right_table, empty_pos_list);
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
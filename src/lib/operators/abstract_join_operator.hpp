@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Base class of all join operators. A join combines each row of the left input with each row of the right input for
+// which "left_value scan_type right_value" holds, where the values are taken from the columns given by column_ids.
+// The output consists of the columns of the left input followed by the columns of the right input. It only contains
+// ReferenceSegments, which reference the tables that store the data.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // Creates the output table with the columns of the left input followed by the columns of the right input. For each
+  // i, the rows left_pos_lists[i][n] and right_pos_lists[i][n] are joined and written into the same chunk. Empty pairs
+  // of position lists are skipped.
+  std::shared_ptr<Table> _create_output_table(const std::vector<std::shared_ptr<const PosList>>& left_pos_lists,
+                                              const std::vector<std::shared_ptr<const PosList>>& right_pos_lists) const;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
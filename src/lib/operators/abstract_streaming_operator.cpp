@@ -0,0 +1,13 @@
+#include "abstract_streaming_operator.hpp"
+
+#include <memory>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void AbstractStreamingOperator::set_streamed_output(const std::shared_ptr<const Table>& output) { _output = output; }
+
+void AbstractSinkOperator::finish_sink() { _output = _on_finish_sink(); }
+
+}  // namespace opossum
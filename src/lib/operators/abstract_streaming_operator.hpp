@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Base class of operators that compute each output chunk from a single chunk of their left input, e.g., scans and
+// projections. Besides being executed as usual, they can be part of a pipeline (see execute_pipelined), which pushes
+// the chunks of its source through all of its operators one at a time, so that their input and output tables are
+// never materialized as a whole.
+class AbstractStreamingOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // Prepares streaming chunks with the columns of input_table through the operator, e.g., by building the hash table
+  // of a join. All inputs but the left one are executed already. Returns a table without rows that has the columns of
+  // the output.
+  virtual std::shared_ptr<Table> prepare_streaming(const std::shared_ptr<const Table>& input_table) = 0;
+
+  // Returns the output chunk for the chunk chunk_id of input_table, which may have no rows. Called concurrently for
+  // different chunks after prepare_streaming.
+  virtual Chunk process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const = 0;
+
+  // sets the output once all chunks were streamed through the operator
+  void set_streamed_output(const std::shared_ptr<const Table>& output);
+};
+
+// Base class of operators that need all rows of their left input before they can output anything, but can consume
+// them chunk by chunk, e.g., the build phase of an aggregation. A pipeline pushes its chunks into such an operator
+// instead of materializing them.
+class AbstractSinkOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // prepares consuming chunks with the columns of input_table
+  virtual void prepare_sink(const std::shared_ptr<const Table>& input_table) = 0;
+
+  // Consumes the chunk chunk_id of input_table. Called concurrently for different chunks after prepare_sink. The
+  // chunk does not have to outlive the call.
+  virtual void consume_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) = 0;
+
+  // computes the output from all consumed chunks
+  void finish_sink();
+
+ protected:
+  virtual std::shared_ptr<const Table> _on_finish_sink() = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,948 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Below this number of pre-aggregated groups, the groups are merged without partitioning
+constexpr auto MIN_GROUPS_FOR_PARALLEL_MERGE = size_t{10'000};
+
+// Group ids are looked up in an array indexed by value id if the array has at most this many entries per row of the
+// morsel (or at most MIN_DENSE_LOOKUP_SIZE entries), as initializing a larger array is more expensive than hashing
+constexpr auto MAX_DENSE_LOOKUP_ENTRIES_PER_ROW = size_t{4};
+constexpr auto MIN_DENSE_LOOKUP_SIZE = size_t{1} << 16;
+
+constexpr auto UNASSIGNED_GROUP_ID = std::numeric_limits<uint32_t>::max();
+constexpr auto UNASSIGNED_KEY_COMPONENT = std::numeric_limits<uint64_t>::max();
+
+// Finalizer of MurmurHash3, which spreads the entropy of all bits over the whole word
+uint64_t mix_bits(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb53ad34e495bull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * The values of a row in the group by columns are encoded as one 64 bit key component per column. Numbers are encoded
+ * by their bit patterns. Strings are first encoded as ids that are local to a morsel, which are translated into ids
+ * that are unique for the whole input before the morsels are merged.
+ */
+template <typename T>
+uint64_t encode_key_component(const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<uint64_t>(static_cast<int64_t>(value));
+  } else {
+    // 0.0 and -0.0 are equal, but have different bit patterns
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto key_component = uint64_t{0};
+    std::memcpy(&key_component, &normalized_value, sizeof(T));
+    return key_component;
+  }
+}
+
+template <typename T>
+T decode_key_component(const uint64_t key_component) {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<T>(static_cast<int64_t>(key_component));
+  } else {
+    auto value = T{};
+    std::memcpy(&value, &key_component, sizeof(T));
+    return value;
+  }
+}
+
+/**
+ * If segment is a DictionarySegment or a ReferenceSegment whose positions all point into the same DictionarySegment,
+ * writes the value ids of the rows [begin_offset, end_offset) to value_ids and returns that DictionarySegment.
+ * Otherwise, returns nullptr and leaves value_ids untouched.
+ */
+template <typename T>
+const DictionarySegment<T>* dictionary_value_ids(const BaseSegment& segment, const ChunkOffset begin_offset,
+                                                 const ChunkOffset end_offset, std::vector<uint64_t>& value_ids) {
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_values) {
+      std::copy(attribute_values.cbegin() + begin_offset, attribute_values.cbegin() + end_offset, value_ids.begin());
+    });
+    return dictionary_segment;
+  }
+
+  const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+  if (!reference_segment) return nullptr;
+
+  const auto& pos_list = *reference_segment->pos_list();
+  if (pos_list.empty() || !pos_list.references_single_chunk()) return nullptr;
+
+  const auto& referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+  const auto referenced_segment = referenced_chunk.get_segment(reference_segment->referenced_column_id());
+  const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(referenced_segment.get());
+  if (!dictionary_segment) return nullptr;
+
+  resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_values) {
+    for (auto offset = begin_offset; offset < end_offset; ++offset) {
+      value_ids[offset - begin_offset] = attribute_values[pos_list[offset].chunk_offset];
+    }
+  });
+  return dictionary_segment;
+}
+
+/**
+ * Kernels for aggregating contiguous values without group by columns. They keep KERNEL_LANES independent intermediate
+ * results, which the compiler maps to the lanes of SIMD registers. This also allows vectorizing floating point sums,
+ * which would otherwise have to be added strictly in order.
+ */
+constexpr auto KERNEL_LANES = size_t{8};
+
+template <typename SumType, typename T>
+SumType sum_kernel(const T* values, const size_t count) {
+  SumType lanes[KERNEL_LANES] = {};
+  auto index = size_t{0};
+  for (; index + KERNEL_LANES <= count; index += KERNEL_LANES) {
+    for (auto lane = size_t{0}; lane < KERNEL_LANES; ++lane) {
+      lanes[lane] += values[index + lane];
+    }
+  }
+
+  auto sum = SumType{0};
+  for (; index < count; ++index) {
+    sum += values[index];
+  }
+  for (const auto lane_sum : lanes) {
+    sum += lane_sum;
+  }
+  return sum;
+}
+
+// returns the result of folding the values (count > 0) with select, e.g., std::min
+template <typename T, typename Select>
+T fold_kernel(const T* values, const size_t count, const Select& select) {
+  T lanes[KERNEL_LANES];
+  std::fill(lanes, lanes + KERNEL_LANES, values[0]);
+  auto index = size_t{0};
+  for (; index + KERNEL_LANES <= count; index += KERNEL_LANES) {
+    for (auto lane = size_t{0}; lane < KERNEL_LANES; ++lane) {
+      lanes[lane] = select(lanes[lane], values[index + lane]);
+    }
+  }
+
+  auto result = lanes[0];
+  for (; index < count; ++index) {
+    result = select(result, values[index]);
+  }
+  for (const auto lane_result : lanes) {
+    result = select(result, lane_result);
+  }
+  return result;
+}
+
+template <typename T>
+T min_kernel(const T* values, const size_t count) {
+  return fold_kernel(values, count, [](const T lhs, const T rhs) { return rhs < lhs ? rhs : lhs; });
+}
+
+template <typename T>
+T max_kernel(const T* values, const size_t count) {
+  return fold_kernel(values, count, [](const T lhs, const T rhs) { return lhs < rhs ? rhs : lhs; });
+}
+
+using GroupKey = std::vector<uint64_t>;
+
+size_t hash_group_key(const uint64_t* key, const size_t key_width) {
+  auto hash = uint64_t{key_width};
+  for (auto index = size_t{0}; index < key_width; ++index) {
+    hash = mix_bits(hash ^ (key[index] + 0x9e3779b97f4a7c15ull));
+  }
+  return hash;
+}
+
+struct GroupKeyHash {
+  size_t operator()(const GroupKey& key) const { return hash_group_key(key.data(), key.size()); }
+};
+
+// Hashes the combination of a group id and the key component of the next group by column
+struct GroupIdAndKeyComponentHash {
+  size_t operator()(const std::pair<uint32_t, uint64_t>& pair) const {
+    return mix_bits(pair.second ^ (uint64_t{pair.first} * 0x9e3779b97f4a7c15ull));
+  }
+};
+
+/**
+ * Holds the intermediate results of one aggregate for a number of groups, e.g., the sums and counts for AVG.
+ */
+class BaseAggregateAccumulator : private Noncopyable {
+ public:
+  virtual ~BaseAggregateAccumulator() = default;
+
+  // creates an accumulator of the same type without groups
+  virtual std::unique_ptr<BaseAggregateAccumulator> create_empty() const = 0;
+
+  // grows the accumulator to group_count groups
+  virtual void resize(const size_t group_count) = 0;
+
+  // Adds the rows [begin_offset, end_offset) of segment, where group_ids[n] is the group of row begin_offset + n. The
+  // segment is not accessed for COUNT, so it may be nullptr.
+  virtual void aggregate(const BaseSegment* segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                         const std::vector<uint32_t>& group_ids) = 0;
+
+  // Adds the rows [begin_offset, end_offset) of segment to group 0, which has to exist. This is used without group by
+  // columns and works directly on the values or value ids of the segment where possible.
+  virtual void aggregate_ungrouped(const BaseSegment* segment, const ChunkOffset begin_offset,
+                                   const ChunkOffset end_offset) = 0;
+
+  // Merges group source_group_ids[n] of other into group target_group_ids[n]. other must be of the same type and is
+  // left in an unspecified state.
+  virtual void merge(BaseAggregateAccumulator& other, const std::vector<uint32_t>& source_group_ids,
+                     const std::vector<uint32_t>& target_group_ids) = 0;
+
+  // moves the final results, one per group, into a segment
+  virtual std::shared_ptr<BaseSegment> result_segment() = 0;
+};
+
+template <typename T, AggregateFunction function>
+class AggregateAccumulator : public BaseAggregateAccumulator {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  std::unique_ptr<BaseAggregateAccumulator> create_empty() const override {
+    return std::make_unique<AggregateAccumulator>();
+  }
+
+  void resize(const size_t group_count) override {
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      _values.resize(group_count);
+      _has_value.resize(group_count, false);
+    } else if constexpr (function == AggregateFunction::Sum) {
+      _sums.resize(group_count, SumType{0});
+    } else if constexpr (function == AggregateFunction::Avg) {  // NOLINT(readability/braces)
+      _sums.resize(group_count, SumType{0});
+      _counts.resize(group_count, 0);
+    } else if constexpr (function == AggregateFunction::Count) {
+      _counts.resize(group_count, 0);
+    } else {
+      _distinct_values.resize(group_count);
+    }
+  }
+
+  void aggregate(const BaseSegment* segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                 const std::vector<uint32_t>& group_ids) override {
+    if constexpr (function == AggregateFunction::Count) {
+      for (const auto group_id : group_ids) {
+        ++_counts[group_id];
+      }
+    } else {
+      DebugAssert(segment, "Aggregate function requires a segment.");
+      segment_iterate_range<T>(*segment, begin_offset, end_offset, [&](const auto& position) {
+        _add(group_ids[position.chunk_offset() - begin_offset], position.value());
+      });
+    }
+  }
+
+  void aggregate_ungrouped(const BaseSegment* segment, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset) override {
+    // COUNT(*) and COUNT(a) only depend on the number of rows
+    if constexpr (function == AggregateFunction::Count) {
+      _counts[0] += end_offset - begin_offset;
+    } else {
+      DebugAssert(segment, "Aggregate function requires a segment.");
+      if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(segment)) {
+        _aggregate_values(value_segment->values().data() + begin_offset, end_offset - begin_offset);
+      } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(segment)) {
+        _aggregate_value_ids(*dictionary_segment, begin_offset, end_offset);
+      } else {
+        segment_iterate_range<T>(*segment, begin_offset, end_offset,
+                                 [&](const auto& position) { _add(0, position.value()); });
+      }
+    }
+  }
+
+  void merge(BaseAggregateAccumulator& base_other, const std::vector<uint32_t>& source_group_ids,
+             const std::vector<uint32_t>& target_group_ids) override {
+    DebugAssert(dynamic_cast<AggregateAccumulator*>(&base_other), "Cannot merge accumulators of different types.");
+    auto& other = static_cast<AggregateAccumulator&>(base_other);
+
+    for (auto index = size_t{0}; index < source_group_ids.size(); ++index) {
+      const auto source_group_id = source_group_ids[index];
+      const auto target_group_id = target_group_ids[index];
+
+      if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+        if (other._has_value[source_group_id]) _add(target_group_id, other._values[source_group_id]);
+      } else if constexpr (function == AggregateFunction::Sum) {
+        _sums[target_group_id] += other._sums[source_group_id];
+      } else if constexpr (function == AggregateFunction::Avg) {  // NOLINT(readability/braces)
+        _sums[target_group_id] += other._sums[source_group_id];
+        _counts[target_group_id] += other._counts[source_group_id];
+      } else if constexpr (function == AggregateFunction::Count) {
+        _counts[target_group_id] += other._counts[source_group_id];
+      } else {
+        auto& target_values = _distinct_values[target_group_id];
+        auto& source_values = other._distinct_values[source_group_id];
+        if (target_values.size() < source_values.size()) std::swap(target_values, source_values);
+        target_values.insert(source_values.cbegin(), source_values.cend());
+      }
+    }
+  }
+
+  std::shared_ptr<BaseSegment> result_segment() override {
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      return std::make_shared<ValueSegment<T>>(std::move(_values));
+    } else if constexpr (function == AggregateFunction::Sum) {
+      return std::make_shared<ValueSegment<SumType>>(std::move(_sums));
+    } else if constexpr (function == AggregateFunction::Avg) {  // NOLINT(readability/braces)
+      auto averages = std::vector<double>(_sums.size());
+      for (auto group_id = size_t{0}; group_id < _sums.size(); ++group_id) {
+        averages[group_id] = _counts[group_id] == 0 ? 0.0 : static_cast<double>(_sums[group_id]) / _counts[group_id];
+      }
+      return std::make_shared<ValueSegment<double>>(std::move(averages));
+    } else if constexpr (function == AggregateFunction::Count) {
+      return std::make_shared<ValueSegment<int64_t>>(std::move(_counts));
+    } else {
+      auto counts = std::vector<int64_t>(_distinct_values.size());
+      for (auto group_id = size_t{0}; group_id < _distinct_values.size(); ++group_id) {
+        counts[group_id] = static_cast<int64_t>(_distinct_values[group_id].size());
+      }
+      return std::make_shared<ValueSegment<int64_t>>(std::move(counts));
+    }
+  }
+
+ protected:
+  // Adds count consecutive values to group 0
+  void _aggregate_values(const T* values, const size_t count) {
+    if (count == 0) return;
+
+    if constexpr ((function == AggregateFunction::Min || function == AggregateFunction::Max) &&
+                  std::is_arithmetic_v<T>) {
+      const auto extremum = function == AggregateFunction::Min ? min_kernel(values, count) : max_kernel(values, count);
+      _add(0, extremum);
+    } else if constexpr (function == AggregateFunction::Sum) {
+      _sums[0] += sum_kernel<SumType>(values, count);
+    } else if constexpr (function == AggregateFunction::Avg) {  // NOLINT(readability/braces)
+      _sums[0] += sum_kernel<SumType>(values, count);
+      _counts[0] += count;
+    } else if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT(readability/braces)
+      _distinct_values[0].insert(values, values + count);
+    } else {
+      for (auto index = size_t{0}; index < count; ++index) {
+        _add(0, values[index]);
+      }
+    }
+  }
+
+  // Adds the rows [begin_offset, end_offset) of a DictionarySegment to group 0 by looking at the value ids or, if the
+  // whole segment is aggregated, only at the dictionary
+  void _aggregate_value_ids(const DictionarySegment<T>& segment, const ChunkOffset begin_offset,
+                            const ChunkOffset end_offset) {
+    if (begin_offset == end_offset) return;
+
+    const auto& dictionary = *segment.dictionary();
+    const auto is_whole_segment = begin_offset == 0 && end_offset == segment.size();
+
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      // The dictionary is sorted, so the smallest value id refers to the minimum
+      if (is_whole_segment) {
+        _add(0, function == AggregateFunction::Min ? dictionary.front() : dictionary.back());
+        return;
+      }
+      resolve_fitted_attribute_vector(*segment.attribute_vector(), [&](const auto& value_ids) {
+        const auto count = size_t{end_offset - begin_offset};
+        const auto value_id = function == AggregateFunction::Min ? min_kernel(value_ids.data() + begin_offset, count)
+                                                                 : max_kernel(value_ids.data() + begin_offset, count);
+        _add(0, dictionary[value_id]);
+      });
+    } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {  // NOLINT
+      // Count the occurrences of each value id, so that each value of the dictionary is only converted once
+      resolve_fitted_attribute_vector(*segment.attribute_vector(), [&](const auto& value_ids) {
+        auto sum = SumType{0};
+        if (dictionary.size() <= size_t{end_offset - begin_offset}) {
+          auto occurrences = std::vector<int64_t>(dictionary.size(), 0);
+          for (auto offset = begin_offset; offset < end_offset; ++offset) {
+            ++occurrences[value_ids[offset]];
+          }
+          for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+            sum += static_cast<SumType>(dictionary[value_id]) * occurrences[value_id];
+          }
+        } else {
+          for (auto offset = begin_offset; offset < end_offset; ++offset) {
+            sum += dictionary[value_ids[offset]];
+          }
+        }
+        _sums[0] += sum;
+      });
+      if constexpr (function == AggregateFunction::Avg) _counts[0] += end_offset - begin_offset;
+    } else if (is_whole_segment) {
+      _distinct_values[0].insert(dictionary.cbegin(), dictionary.cend());
+    } else {
+      segment_iterate_range<T>(segment, begin_offset, end_offset,
+                               [&](const auto& position) { _add(0, position.value()); });
+    }
+  }
+
+  void _add(const uint32_t group_id, const T& value) {
+    if constexpr (function == AggregateFunction::Min) {
+      if (!_has_value[group_id] || value < _values[group_id]) {
+        _values[group_id] = value;
+        _has_value[group_id] = true;
+      }
+    } else if constexpr (function == AggregateFunction::Max) {  // NOLINT(readability/braces)
+      if (!_has_value[group_id] || _values[group_id] < value) {
+        _values[group_id] = value;
+        _has_value[group_id] = true;
+      }
+    } else if constexpr (function == AggregateFunction::Sum) {
+      _sums[group_id] += value;
+    } else if constexpr (function == AggregateFunction::Avg) {  // NOLINT(readability/braces)
+      _sums[group_id] += value;
+      ++_counts[group_id];
+    } else if constexpr (function == AggregateFunction::CountDistinct) {
+      _distinct_values[group_id].insert(value);
+    }
+  }
+
+  // Only the members required by the aggregate function are used
+  std::vector<T> _values;
+  std::vector<bool> _has_value;
+  std::vector<SumType> _sums;
+  std::vector<int64_t> _counts;
+  std::vector<std::unordered_set<T>> _distinct_values;
+};
+
+std::unique_ptr<BaseAggregateAccumulator> make_accumulator(const std::string& data_type,
+                                                           const AggregateFunction function) {
+  auto accumulator = std::unique_ptr<BaseAggregateAccumulator>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (function) {
+      case AggregateFunction::Min:
+        accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::Min>>();
+        break;
+      case AggregateFunction::Max:
+        accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::Max>>();
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          Fail("SUM and AVG are not defined for strings.");
+        } else if (function == AggregateFunction::Sum) {
+          accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::Sum>>();
+        } else {
+          accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::Avg>>();
+        }
+        break;
+      case AggregateFunction::Count:
+        accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::Count>>();
+        break;
+      case AggregateFunction::CountDistinct:
+        accumulator = std::make_unique<AggregateAccumulator<ColumnDataType, AggregateFunction::CountDistinct>>();
+        break;
+    }
+  });
+  Assert(static_cast<bool>(accumulator), "Unknown aggregate function.");
+  return accumulator;
+}
+
+std::string result_data_type(const std::string& data_type, const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return data_type;
+    case AggregateFunction::Sum:
+      return data_type == "int" || data_type == "long" ? "long" : "double";
+    case AggregateFunction::Avg:
+      return "double";
+    case AggregateFunction::Count:
+    case AggregateFunction::CountDistinct:
+      return "long";
+  }
+  Fail("Unknown aggregate function.");
+  return "";
+}
+
+std::string result_column_name(const Table& input_table, const AggregateColumnDefinition& aggregate) {
+  if (!aggregate.column_id) return "COUNT(*)";
+
+  const auto& column_name = input_table.column_name(*aggregate.column_id);
+  switch (aggregate.function) {
+    case AggregateFunction::Min:
+      return "MIN(" + column_name + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+    case AggregateFunction::CountDistinct:
+      return "COUNT(DISTINCT " + column_name + ")";
+  }
+  Fail("Unknown aggregate function.");
+  return "";
+}
+
+// A range of rows of one chunk, which is the unit of work for the pre-aggregation
+struct Morsel {
+  const Chunk* chunk;
+  ChunkOffset begin_offset;
+  ChunkOffset end_offset;
+};
+
+// The pre-aggregated groups of a morsel or the merged groups of a partition
+struct GroupAggregation {
+  size_t group_count{0};
+
+  // The key of group g is stored at [g * key_width, (g + 1) * key_width)
+  std::vector<uint64_t> keys;
+
+  // one accumulator per aggregate
+  std::vector<std::unique_ptr<BaseAggregateAccumulator>> accumulators;
+
+  // Only used for morsels: for each string group by column, the strings in the order of their morsel-local ids
+  std::vector<std::vector<std::string>> local_strings;
+
+  // Only used for morsels: the ids of the groups that belong to each partition
+  std::vector<std::vector<uint32_t>> group_ids_by_partition;
+};
+
+}  // namespace
+
+class AggregateImpl {
+ public:
+  AggregateImpl(const std::shared_ptr<const Table>& input_table,
+                const std::vector<AggregateColumnDefinition>& aggregates,
+                const std::vector<ColumnID>& group_by_column_ids)
+      : _input_table(input_table),
+        _aggregates(aggregates),
+        _group_by_column_ids(group_by_column_ids),
+        _key_width(group_by_column_ids.size()),
+        _global_strings(group_by_column_ids.size()) {
+    for (const auto& aggregate : _aggregates) {
+      // The data type does not matter for COUNT(*)
+      const auto& data_type = aggregate.column_id ? _input_table->column_type(*aggregate.column_id) : "int";
+      _prototypes.emplace_back(make_accumulator(data_type, aggregate.function));
+    }
+  }
+
+  std::shared_ptr<Table> execute() {
+    // Pre-aggregate each morsel into its own groups
+    auto morsels = std::vector<Morsel>{};
+    for (ChunkID chunk_id{0}; chunk_id < _input_table->chunk_count(); ++chunk_id) {
+      const auto chunk_morsels = _create_morsels(_input_table->get_chunk(chunk_id));
+      morsels.insert(morsels.end(), chunk_morsels.cbegin(), chunk_morsels.cend());
+    }
+    _morsel_aggregations.resize(morsels.size());
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(morsels.size());
+    for (auto morsel_id = size_t{0}; morsel_id < morsels.size(); ++morsel_id) {
+      jobs.emplace_back([&, morsel_id]() { _morsel_aggregations[morsel_id] = _aggregate_morsel(morsels[morsel_id]); });
+    }
+    execute_in_parallel(jobs);
+
+    return finish();
+  }
+
+  // Pre-aggregates the morsels of a chunk, which is not accessed anymore afterwards. Can be called concurrently.
+  void consume(const Chunk& chunk) {
+    auto aggregations = std::vector<GroupAggregation>{};
+    for (const auto& morsel : _create_morsels(chunk)) {
+      aggregations.emplace_back(_aggregate_morsel(morsel));
+    }
+
+    std::lock_guard lock(_morsel_aggregations_mutex);
+    std::move(aggregations.begin(), aggregations.end(), std::back_inserter(_morsel_aggregations));
+  }
+
+  // merges the pre-aggregated morsels into the output
+  std::shared_ptr<Table> finish() {
+    auto& morsel_aggregations = _morsel_aggregations;
+    _translate_string_ids(morsel_aggregations);
+
+    // Assign the groups of each morsel to partitions by hash
+    auto group_count = size_t{0};
+    for (const auto& morsel_aggregation : morsel_aggregations) {
+      group_count += morsel_aggregation.group_count;
+    }
+    const auto partition_count = _key_width > 0 && group_count >= MIN_GROUPS_FOR_PARALLEL_MERGE
+                                     ? size_t{2} * std::max(std::thread::hardware_concurrency(), 1u)
+                                     : size_t{1};
+
+    auto jobs = std::vector<std::function<void()>>{};
+    for (auto& morsel_aggregation : morsel_aggregations) {
+      jobs.emplace_back([&]() {
+        auto& group_ids_by_partition = morsel_aggregation.group_ids_by_partition;
+        group_ids_by_partition.resize(partition_count);
+        for (auto group_id = uint32_t{0}; group_id < morsel_aggregation.group_count; ++group_id) {
+          const auto hash = hash_group_key(morsel_aggregation.keys.data() + group_id * _key_width, _key_width);
+          group_ids_by_partition[hash % partition_count].emplace_back(group_id);
+        }
+      });
+    }
+    execute_in_parallel(jobs);
+
+    // Merge the groups of all morsels per partition
+    auto partition_aggregations = std::vector<GroupAggregation>(partition_count);
+    jobs.clear();
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back([&, partition_id]() {
+        partition_aggregations[partition_id] = _merge_partition(partition_id, morsel_aggregations);
+      });
+    }
+    execute_in_parallel(jobs);
+
+    // Without group by columns, there is exactly one group, even if the input is empty
+    if (_key_width == 0 && partition_aggregations.front().group_count == 0) {
+      partition_aggregations.front().group_count = 1;
+      for (auto& accumulator : partition_aggregations.front().accumulators) {
+        accumulator->resize(1);
+      }
+    }
+
+    return _create_output_table(partition_aggregations);
+  }
+
+ protected:
+  static std::vector<Morsel> _create_morsels(const Chunk& chunk) {
+    auto morsels = std::vector<Morsel>{};
+    const auto chunk_size = chunk.size();
+    for (auto begin_offset = ChunkOffset{0}; begin_offset < chunk_size; begin_offset += Aggregate::MORSEL_SIZE) {
+      const auto end_offset = std::min(chunk_size, begin_offset + Aggregate::MORSEL_SIZE);
+      morsels.emplace_back(Morsel{&chunk, begin_offset, end_offset});
+    }
+    return morsels;
+  }
+
+  GroupAggregation _aggregate_morsel(const Morsel& morsel) const {
+    const auto& chunk = *morsel.chunk;
+    const auto row_count = morsel.end_offset - morsel.begin_offset;
+
+    auto aggregation = GroupAggregation{};
+    aggregation.local_strings.resize(_key_width);
+
+    // Without group by columns, all rows belong to group 0 and no group ids are needed. Otherwise, the group ids are
+    // refined column by column: rows keep sharing a group id only if they also share the key component of the next
+    // column.
+    auto group_ids = std::vector<uint32_t>(_key_width > 0 ? row_count : 0, 0);
+    auto group_count = size_t{row_count > 0 ? 1u : 0u};
+    auto key_components = std::vector<std::vector<uint64_t>>(_key_width);
+
+    // For dictionary-encoded group by columns, the key components are the value ids of the rows until the keys of the
+    // groups are collected. As value ids are dense, the next group ids can be looked up in an array indexed by the
+    // current group id and the value id instead of hashing the values.
+    auto dictionary_segments = std::vector<const BaseSegment*>(_key_width, nullptr);
+
+    for (auto key_index = size_t{0}; key_index < _key_width; ++key_index) {
+      const auto column_id = _group_by_column_ids[key_index];
+      const auto& segment = *chunk.get_segment(column_id);
+      auto& components = key_components[key_index];
+      components.resize(row_count);
+      auto value_id_count = size_t{0};
+
+      resolve_data_type(_input_table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        const auto dictionary_segment =
+            dictionary_value_ids<ColumnDataType>(segment, morsel.begin_offset, morsel.end_offset, components);
+        if (dictionary_segment) {
+          dictionary_segments[key_index] = dictionary_segment;
+          value_id_count = dictionary_segment->unique_values_count();
+          return;
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto& strings = aggregation.local_strings[key_index];
+          auto local_ids = std::unordered_map<std::string, uint64_t>{};
+          const auto add_string = [&](const auto& position) {
+            const auto emplace_result = local_ids.try_emplace(position.value(), strings.size());
+            if (emplace_result.second) strings.emplace_back(position.value());
+            components[position.chunk_offset() - morsel.begin_offset] = emplace_result.first->second;
+          };
+          segment_iterate_range<std::string>(segment, morsel.begin_offset, morsel.end_offset, add_string);
+        } else {
+          const auto add_value = [&](const auto& position) {
+            components[position.chunk_offset() - morsel.begin_offset] = encode_key_component(position.value());
+          };
+          segment_iterate_range<ColumnDataType>(segment, morsel.begin_offset, morsel.end_offset, add_value);
+        }
+      });
+
+      const auto dense_lookup_size = group_count * value_id_count;
+      if (value_id_count > 0 &&
+          dense_lookup_size <= std::max(MAX_DENSE_LOOKUP_ENTRIES_PER_ROW * row_count, MIN_DENSE_LOOKUP_SIZE)) {
+        auto ids = std::vector<uint32_t>(dense_lookup_size, UNASSIGNED_GROUP_ID);
+        auto next_group_id = uint32_t{0};
+        for (auto row = size_t{0}; row < row_count; ++row) {
+          auto& id = ids[group_ids[row] * value_id_count + components[row]];
+          if (id == UNASSIGNED_GROUP_ID) id = next_group_id++;
+          group_ids[row] = id;
+        }
+        group_count = next_group_id;
+      } else if (key_index == 0) {
+        auto ids = std::unordered_map<uint64_t, uint32_t>{};
+        for (auto row = size_t{0}; row < row_count; ++row) {
+          group_ids[row] = ids.try_emplace(components[row], ids.size()).first->second;
+        }
+        group_count = ids.size();
+      } else {
+        auto ids = std::unordered_map<std::pair<uint32_t, uint64_t>, uint32_t, GroupIdAndKeyComponentHash>{};
+        for (auto row = size_t{0}; row < row_count; ++row) {
+          group_ids[row] = ids.try_emplace(std::make_pair(group_ids[row], components[row]), ids.size()).first->second;
+        }
+        group_count = ids.size();
+      }
+    }
+
+    // Collect the key of each group from its first row
+    aggregation.group_count = group_count;
+    aggregation.keys.resize(group_count * _key_width);
+    auto next_new_group_id = uint32_t{0};
+    for (auto row = size_t{0}; _key_width > 0 && row < row_count && next_new_group_id < group_count; ++row) {
+      // Group ids are assigned in the order in which the groups first appear
+      if (group_ids[row] != next_new_group_id) continue;
+      for (auto key_index = size_t{0}; key_index < _key_width; ++key_index) {
+        aggregation.keys[next_new_group_id * _key_width + key_index] = key_components[key_index][row];
+      }
+      ++next_new_group_id;
+    }
+
+    // Only now, the value ids are mapped to values. The dictionaries of the chunks differ, so this has to happen
+    // before the morsels are merged.
+    for (auto key_index = size_t{0}; key_index < _key_width; ++key_index) {
+      if (!dictionary_segments[key_index]) continue;
+
+      resolve_data_type(_input_table->column_type(_group_by_column_ids[key_index]), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto& dictionary_segment = static_cast<const DictionarySegment<ColumnDataType>&>(
+            *dictionary_segments[key_index]);
+        const auto& dictionary = *dictionary_segment.dictionary();
+
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto& strings = aggregation.local_strings[key_index];
+          auto local_ids = std::vector<uint64_t>(dictionary.size(), UNASSIGNED_KEY_COMPONENT);
+          for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+            auto& key_component = aggregation.keys[group_id * _key_width + key_index];
+            auto& local_id = local_ids[key_component];
+            if (local_id == UNASSIGNED_KEY_COMPONENT) {
+              local_id = strings.size();
+              strings.emplace_back(dictionary[key_component]);
+            }
+            key_component = local_id;
+          }
+        } else {
+          for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+            auto& key_component = aggregation.keys[group_id * _key_width + key_index];
+            key_component = encode_key_component(dictionary[key_component]);
+          }
+        }
+      });
+    }
+
+    for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+      const auto& column_id = _aggregates[aggregate_id].column_id;
+      const auto segment = column_id ? chunk.get_segment(*column_id) : nullptr;
+
+      auto accumulator = _prototypes[aggregate_id]->create_empty();
+      accumulator->resize(group_count);
+      if (_key_width == 0) {
+        accumulator->aggregate_ungrouped(segment.get(), morsel.begin_offset, morsel.end_offset);
+      } else {
+        accumulator->aggregate(segment.get(), morsel.begin_offset, morsel.end_offset, group_ids);
+      }
+      aggregation.accumulators.emplace_back(std::move(accumulator));
+    }
+
+    return aggregation;
+  }
+
+  // Replaces the morsel-local string ids in the keys by ids that are unique for the whole input
+  void _translate_string_ids(std::vector<GroupAggregation>& morsel_aggregations) {
+    for (auto key_index = size_t{0}; key_index < _key_width; ++key_index) {
+      if (_input_table->column_type(_group_by_column_ids[key_index]) != "string") continue;
+
+      auto& global_strings = _global_strings[key_index];
+      auto global_ids = std::unordered_map<std::string, uint64_t>{};
+      for (auto& morsel_aggregation : morsel_aggregations) {
+        auto& local_strings = morsel_aggregation.local_strings[key_index];
+
+        auto global_ids_by_local_id = std::vector<uint64_t>(local_strings.size());
+        for (auto local_id = size_t{0}; local_id < local_strings.size(); ++local_id) {
+          const auto emplace_result = global_ids.try_emplace(local_strings[local_id], global_strings.size());
+          if (emplace_result.second) global_strings.emplace_back(std::move(local_strings[local_id]));
+          global_ids_by_local_id[local_id] = emplace_result.first->second;
+        }
+
+        for (auto group_id = size_t{0}; group_id < morsel_aggregation.group_count; ++group_id) {
+          auto& key_component = morsel_aggregation.keys[group_id * _key_width + key_index];
+          key_component = global_ids_by_local_id[key_component];
+        }
+      }
+    }
+  }
+
+  GroupAggregation _merge_partition(const size_t partition_id,
+                                    std::vector<GroupAggregation>& morsel_aggregations) const {
+    auto aggregation = GroupAggregation{};
+    for (const auto& prototype : _prototypes) {
+      aggregation.accumulators.emplace_back(prototype->create_empty());
+    }
+
+    auto group_ids = std::unordered_map<GroupKey, uint32_t, GroupKeyHash>{};
+    auto target_group_ids = std::vector<uint32_t>{};
+
+    for (auto& morsel_aggregation : morsel_aggregations) {
+      const auto& source_group_ids = morsel_aggregation.group_ids_by_partition[partition_id];
+      if (source_group_ids.empty()) continue;
+
+      target_group_ids.clear();
+      for (const auto source_group_id : source_group_ids) {
+        const auto key_begin = morsel_aggregation.keys.cbegin() + source_group_id * _key_width;
+        const auto key_end = key_begin + _key_width;
+        const auto emplace_result = group_ids.try_emplace(GroupKey(key_begin, key_end), group_ids.size());
+        if (emplace_result.second) aggregation.keys.insert(aggregation.keys.end(), key_begin, key_end);
+        target_group_ids.emplace_back(emplace_result.first->second);
+      }
+
+      for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+        aggregation.accumulators[aggregate_id]->resize(group_ids.size());
+        aggregation.accumulators[aggregate_id]->merge(*morsel_aggregation.accumulators[aggregate_id],
+                                                      source_group_ids, target_group_ids);
+      }
+    }
+
+    aggregation.group_count = group_ids.size();
+    return aggregation;
+  }
+
+  std::shared_ptr<Table> _create_output_table(std::vector<GroupAggregation>& partition_aggregations) const {
+    auto output_table = std::make_shared<Table>();
+    for (const auto& column_id : _group_by_column_ids) {
+      output_table->add_column_definition(_input_table->column_name(column_id), _input_table->column_type(column_id));
+    }
+    for (const auto& aggregate : _aggregates) {
+      const auto& data_type = aggregate.column_id ? _input_table->column_type(*aggregate.column_id) : "int";
+      output_table->add_column_definition(result_column_name(*_input_table, aggregate),
+                                          result_data_type(data_type, aggregate.function));
+    }
+
+    for (auto& aggregation : partition_aggregations) {
+      if (aggregation.group_count == 0) continue;
+
+      Chunk chunk;
+      for (auto key_index = size_t{0}; key_index < _key_width; ++key_index) {
+        resolve_data_type(_input_table->column_type(_group_by_column_ids[key_index]), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto values = std::vector<ColumnDataType>(aggregation.group_count);
+          for (auto group_id = size_t{0}; group_id < aggregation.group_count; ++group_id) {
+            const auto key_component = aggregation.keys[group_id * _key_width + key_index];
+            if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+              values[group_id] = _global_strings[key_index][key_component];
+            } else {
+              values[group_id] = decode_key_component<ColumnDataType>(key_component);
+            }
+          }
+          chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        });
+      }
+
+      for (auto& accumulator : aggregation.accumulators) {
+        chunk.add_segment(accumulator->result_segment());
+      }
+      output_table->emplace_chunk(std::move(chunk));
+    }
+
+    // In case there are no groups, create one chunk with empty segments
+    if (output_table->row_count() == 0) {
+      Chunk chunk;
+      for (ColumnID column_id{0}; column_id < output_table->column_count(); ++column_id) {
+        chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(output_table->column_type(column_id)));
+      }
+      output_table->emplace_chunk(std::move(chunk));
+    }
+
+    return output_table;
+  }
+
+  const std::shared_ptr<const Table> _input_table;
+  const std::vector<AggregateColumnDefinition>& _aggregates;
+  const std::vector<ColumnID>& _group_by_column_ids;
+  const size_t _key_width;
+
+  // one empty accumulator per aggregate, from which the accumulators of the morsels and partitions are created
+  std::vector<std::unique_ptr<BaseAggregateAccumulator>> _prototypes;
+
+  // for each string group by column, the strings in the order of their global ids
+  std::vector<std::vector<std::string>> _global_strings;
+
+  // the pre-aggregated groups of all morsels
+  std::vector<GroupAggregation> _morsel_aggregations;
+  std::mutex _morsel_aggregations_mutex;
+};
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractSinkOperator(in), _aggregates(aggregates), _group_by_column_ids(group_by_column_ids) {
+  Assert(in != nullptr, "Input operator must be defined.");
+  Assert(!aggregates.empty() || !group_by_column_ids.empty(), "Aggregate requires aggregates or group by columns.");
+  for (const auto& aggregate : aggregates) {
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only COUNT can be computed without a column.");
+  }
+}
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  return AggregateImpl{input_table, _aggregates, _group_by_column_ids}.execute();
+}
+
+void Aggregate::prepare_sink(const std::shared_ptr<const Table>& input_table) {
+  _sink_impl = std::make_shared<AggregateImpl>(input_table, _aggregates, _group_by_column_ids);
+}
+
+void Aggregate::consume_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) {
+  _sink_impl->consume(input_table->get_chunk(chunk_id));
+}
+
+std::shared_ptr<const Table> Aggregate::_on_finish_sink() {
+  const auto output_table = _sink_impl->finish();
+  _sink_impl = nullptr;
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AggregateImpl;
+class Table;
+
+enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct };
+
+// Describes one aggregate of the output, e.g., SUM(column_id). column_id is empty for COUNT(*).
+struct AggregateColumnDefinition {
+  AggregateColumnDefinition(const std::optional<ColumnID>& column_id, const AggregateFunction function)
+      : column_id(column_id), function(function) {}
+
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+/**
+ * Groups the input rows by the values of the group by columns and computes the aggregates for each group. The output
+ * contains the group by columns followed by one column per aggregate, named like "SUM(a)", "COUNT(*)", or
+ * "COUNT(DISTINCT a)". The order of the output rows is undefined.
+ *
+ * COUNT and COUNT DISTINCT return a long, SUM returns a long for integral inputs and a double otherwise, AVG returns a
+ * double, and MIN and MAX return the type of their input. As there are no NULLs, COUNT(a) equals COUNT(*). Without
+ * group by columns, the output has exactly one row, even for an empty input. In that case, SUM and AVG are 0, and MIN
+ * and MAX return the default value of their type.
+ *
+ * The input is split into morsels of at most MORSEL_SIZE rows. Each morsel is pre-aggregated into its own hash table
+ * in parallel. Then, the groups are divided into partitions by hash, and the pre-aggregated groups of all morsels are
+ * merged per partition in parallel. Each partition becomes one chunk of the output.
+ *
+ * Group by columns that are dictionary-encoded (directly or through a ReferenceSegment that references a single chunk)
+ * are grouped by their value ids, using arrays indexed by value id instead of hash tables where the arrays are small
+ * enough. The value ids are mapped to values only once per group and morsel, right before the morsels are merged.
+ *
+ * Without group by columns, the aggregates are computed directly on the values of ValueSegments using vectorizable
+ * kernels. For DictionarySegments, MIN and MAX are taken from the dictionary and SUM and AVG only convert each
+ * dictionary entry once. COUNT only looks at the number of rows.
+ *
+ * In a pipeline, the morsels of each chunk are pre-aggregated as the chunk arrives, and the merge runs once the
+ * pipeline is done.
+ */
+class Aggregate : public AbstractSinkOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  static constexpr auto MORSEL_SIZE = ChunkOffset{100'000};
+
+  void prepare_sink(const std::shared_ptr<const Table>& input_table) override;
+  void consume_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<const Table> _on_finish_sink() override;
+
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+
+  // pre-aggregates the chunks consumed in a pipeline
+  std::shared_ptr<AggregateImpl> _sink_impl;
+};
+
+}  // namespace opossum
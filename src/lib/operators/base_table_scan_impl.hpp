@@ -16,6 +16,9 @@ class BaseTableScanImpl : private Noncopyable {
   virtual ~BaseTableScanImpl() = default;
 
   virtual std::shared_ptr<const Table> execute() const = 0;
+
+  // returns the selected rows of a single chunk of the input table
+  virtual std::shared_ptr<const PosList> scan_chunk(const ChunkID chunk_id) const = 0;
 };
 
 }  // namespace opossum
@@ -0,0 +1,132 @@
+#include "distinct.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "aggregate.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the sorted, distinct values of a single column whose segments are all DictionarySegments or ValueSegments,
+// or nullptr if the column contains other segments or no DictionarySegment at all
+template <typename T>
+std::shared_ptr<ValueSegment<T>> merge_dictionaries(const Table& table) {
+  auto dictionaries = std::vector<const std::vector<T>*>{};
+  auto value_segments = std::vector<const ValueSegment<T>*>{};
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    const auto segment = chunk.get_segment(ColumnID{0});
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(segment.get())) {
+      dictionaries.emplace_back(dictionary_segment->dictionary().get());
+    } else if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(segment.get())) {
+      value_segments.emplace_back(value_segment);
+    } else {
+      return nullptr;
+    }
+  }
+  if (dictionaries.empty()) return nullptr;
+
+  // Each dictionary and the sorted values of each ValueSegment form a run. Dictionaries are only referenced.
+  auto value_runs = std::vector<std::vector<T>>(value_segments.size());
+  auto jobs = std::vector<std::function<void()>>{};
+  for (auto index = size_t{0}; index < value_segments.size(); ++index) {
+    jobs.emplace_back([&, index]() {
+      auto& run = value_runs[index];
+      run = value_segments[index]->values();
+      std::sort(run.begin(), run.end());
+      run.erase(std::unique(run.begin(), run.end()), run.end());
+    });
+  }
+  execute_in_parallel(jobs);
+
+  auto run_pointers = dictionaries;
+  for (const auto& run : value_runs) {
+    run_pointers.emplace_back(&run);
+  }
+
+  // Merge the runs pairwise until only one is left. set_union keeps the merged runs free of duplicates.
+  auto merged_runs = std::vector<std::vector<T>>{};
+  while (run_pointers.size() > 1) {
+    auto next_merged_runs = std::vector<std::vector<T>>((run_pointers.size() + 1) / 2);
+    jobs.clear();
+    for (auto index = size_t{0}; index < next_merged_runs.size(); ++index) {
+      jobs.emplace_back([&, index]() {
+        const auto& left = *run_pointers[2 * index];
+        auto& merged_run = next_merged_runs[index];
+        if (2 * index + 1 == run_pointers.size()) {
+          merged_run = left;
+          return;
+        }
+
+        const auto& right = *run_pointers[2 * index + 1];
+        merged_run.reserve(left.size() + right.size());
+        std::set_union(left.cbegin(), left.cend(), right.cbegin(), right.cend(), std::back_inserter(merged_run));
+      });
+    }
+    execute_in_parallel(jobs);
+
+    merged_runs = std::move(next_merged_runs);
+    run_pointers.clear();
+    for (const auto& run : merged_runs) {
+      run_pointers.emplace_back(&run);
+    }
+  }
+
+  if (merged_runs.empty()) return std::make_shared<ValueSegment<T>>(std::vector<T>(*run_pointers.front()));
+  return std::make_shared<ValueSegment<T>>(std::move(merged_runs.front()));
+}
+
+}  // namespace
+
+Distinct::Distinct(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {
+  Assert(in != nullptr, "Input operator must be defined.");
+}
+
+std::shared_ptr<const Table> Distinct::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  if (input_table->column_count() == 1) {
+    auto segment = std::shared_ptr<BaseSegment>{};
+    resolve_data_type(input_table->column_type(ColumnID{0}), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segment = merge_dictionaries<ColumnDataType>(*input_table);
+    });
+
+    if (segment) {
+      auto output_table = std::make_shared<Table>();
+      output_table->add_column_definition(input_table->column_name(ColumnID{0}), input_table->column_type(ColumnID{0}));
+      Chunk chunk;
+      chunk.add_segment(segment);
+      output_table->emplace_chunk(std::move(chunk));
+      return output_table;
+    }
+  }
+
+  auto group_by_column_ids = std::vector<ColumnID>{};
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    group_by_column_ids.emplace_back(column_id);
+  }
+  auto aggregate =
+      std::make_shared<Aggregate>(_input_left, std::vector<AggregateColumnDefinition>{}, group_by_column_ids);
+  aggregate->execute();
+  return aggregate->get_output();
+}
+
+}  // namespace opossum
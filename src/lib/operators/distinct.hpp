@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Outputs each distinct row of its input once. The output consists of ValueSegments. Its order is undefined.
+ *
+ * For a single column that consists of DictionarySegments (and possibly ValueSegments, e.g., for the last chunk that
+ * is still being appended to), the distinct values are the union of the dictionaries, which are sorted and free of
+ * duplicates already. They are merged pairwise in parallel without looking at the attribute vectors. The values of
+ * ValueSegments are sorted and deduplicated first. In this case, the output is sorted.
+ *
+ * All other inputs are grouped by all of their columns using the parallel hash-based Aggregate.
+ */
+class Distinct : public AbstractOperator {
+ public:
+  explicit Distinct(const std::shared_ptr<const AbstractOperator> in);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,184 @@
+#include "index_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+#include "resolve_type.hpp"
+#include "segment_scanner.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids,
+                     const ScanType scan_type, const std::vector<AllTypeVariant>& search_values)
+    : AbstractOperator(in), _column_ids(column_ids), _scan_type(scan_type), _search_values(search_values) {
+  Assert(in != nullptr, "Input operator must be defined.");
+  Assert(!_column_ids.empty(), "IndexScan requires at least one column.");
+  Assert(_column_ids.size() == _search_values.size(), "IndexScan requires one search value per column.");
+}
+
+const std::vector<ColumnID>& IndexScan::column_ids() const { return _column_ids; }
+
+ScanType IndexScan::scan_type() const { return _scan_type; }
+
+const std::vector<AllTypeVariant>& IndexScan::search_values() const { return _search_values; }
+
+std::shared_ptr<const BaseIndex> IndexScan::find_index(const Chunk& chunk, const std::vector<ColumnID>& column_ids) {
+  for (const auto& index : chunk.get_indexes()) {
+    const auto indexed_segments = index->get_indexed_segments();
+    if (indexed_segments.size() < column_ids.size()) continue;
+
+    auto is_suitable = true;
+    for (auto position = size_t{0}; position < column_ids.size(); ++position) {
+      is_suitable &= indexed_segments[position] == chunk.get_segment(column_ids[position]);
+    }
+    if (is_suitable) return index;
+  }
+  return nullptr;
+}
+
+std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>> IndexScan::matching_ranges(
+    const BaseIndex& index, const ScanType scan_type, const std::vector<AllTypeVariant>& search_values) {
+  // The rows with the equal values in all but the last column are [prefix_begin, prefix_end). Within this range, they
+  // are sorted by the value in the last column.
+  const auto prefix_values = std::vector<AllTypeVariant>(search_values.cbegin(), search_values.cend() - 1);
+  const auto prefix_begin = prefix_values.empty() ? index.cbegin() : index.lower_bound(prefix_values);
+  const auto prefix_end = prefix_values.empty() ? index.cend() : index.upper_bound(prefix_values);
+  const auto lower_bound = index.lower_bound(search_values);
+  const auto upper_bound = index.upper_bound(search_values);
+
+  auto ranges = std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>{};
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      ranges.emplace_back(lower_bound, upper_bound);
+      break;
+    case ScanType::OpNotEquals:
+      ranges.emplace_back(prefix_begin, lower_bound);
+      ranges.emplace_back(upper_bound, prefix_end);
+      break;
+    case ScanType::OpLessThan:
+      ranges.emplace_back(prefix_begin, lower_bound);
+      break;
+    case ScanType::OpLessThanEquals:
+      ranges.emplace_back(prefix_begin, upper_bound);
+      break;
+    case ScanType::OpGreaterThan:
+      ranges.emplace_back(upper_bound, prefix_end);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      ranges.emplace_back(lower_bound, prefix_end);
+      break;
+  }
+  return ranges;
+}
+
+PosList IndexScan::positions(const ChunkID chunk_id,
+                             const std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>& ranges) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (const auto& range : ranges) {
+    chunk_offsets.insert(chunk_offsets.end(), range.first, range.second);
+  }
+  std::sort(chunk_offsets.begin(), chunk_offsets.end());
+
+  auto pos_list = PosList{};
+  pos_list.reserve(chunk_offsets.size());
+  for (const auto& chunk_offset : chunk_offsets) {
+    pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+  pos_list.guarantee_single_chunk();
+  pos_list.guarantee_sorted();
+  return pos_list;
+}
+
+std::shared_ptr<const Table> IndexScan::_on_execute() {
+  const auto& input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  auto pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+  auto jobs = std::vector<std::function<void()>>{};
+  auto node_ids = std::vector<NodeID>{};
+  jobs.reserve(chunk_count);
+  node_ids.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    node_ids.emplace_back(input_table->get_chunk(chunk_id).node_id());
+    jobs.emplace_back([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) return;
+
+      if (const auto index = find_index(chunk, _column_ids)) {
+        pos_lists[chunk_id] =
+            std::make_shared<const PosList>(positions(chunk_id, matching_ranges(*index, _scan_type, _search_values)));
+      } else {
+        pos_lists[chunk_id] = std::make_shared<const PosList>(_scan_sequentially(*input_table, chunk_id));
+      }
+    });
+  }
+  execute_in_parallel(jobs, node_ids);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& pos_list = pos_lists[chunk_id];
+    if (!pos_list || pos_list->empty()) continue;
+
+    // The output chunk stays on the node of the input chunk, so that its consumers run there as well
+    Chunk chunk;
+    write_output_segments(chunk, input_table, pos_list);
+    chunk.set_node_id(node_ids[chunk_id]);
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  if (output_table->row_count() == 0) {
+    Chunk chunk;
+    write_output_segments(chunk, input_table, std::make_shared<const PosList>());
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+PosList IndexScan::_scan_sequentially(const Table& table, const ChunkID chunk_id) const {
+  const auto& chunk = table.get_chunk(chunk_id);
+  auto matches = std::vector<bool>(chunk.size(), true);
+
+  for (auto position = size_t{0}; position < _column_ids.size(); ++position) {
+    const auto column_id = _column_ids[position];
+    const auto scan_type = position + 1 < _column_ids.size() ? ScanType::OpEquals : _scan_type;
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto search_value = type_cast<ColumnDataType>(_search_values[position]);
+      const auto scanner = AbstractSegmentScanner<ColumnDataType>::from_scan_type(scan_type);
+      segment_iterate<ColumnDataType>(*chunk.get_segment(column_id), [&](const auto& segment_position) {
+        const auto chunk_offset = segment_position.chunk_offset();
+        if (matches[chunk_offset] && !scanner->compare(segment_position.value(), search_value)) {
+          matches[chunk_offset] = false;
+        }
+      });
+    });
+  }
+
+  auto pos_list = PosList{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    if (matches[chunk_offset]) pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+  pos_list.guarantee_single_chunk();
+  pos_list.guarantee_sorted();
+  return pos_list;
+}
+
+}  // namespace opossum
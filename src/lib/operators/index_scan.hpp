@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Scans the input through the indexes of its chunks. The rows are selected by their values in column_ids: all columns
+ * but the last one have to equal their search value, and the value in the last column is compared with its search
+ * value using scan_type. This way, a composite index on (a, b, c) answers a = 1 AND b = 2 AND c < 3 with one lookup.
+ *
+ * A chunk can be scanned with any index whose first indexed segments are those of column_ids, e.g., the index on
+ * (a, b, c) also answers predicates on a or on (a, b). Chunks without such an index (including all chunks of
+ * ReferenceSegments) are scanned sequentially, so that the operator works on any input. The matching offsets of a
+ * chunk are sorted, so that the output lists the selected rows in the same order as the TableScan does.
+ */
+class IndexScan : public AbstractOperator {
+ public:
+  IndexScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids,
+            const ScanType scan_type, const std::vector<AllTypeVariant>& search_values);
+
+  const std::vector<ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+  const std::vector<AllTypeVariant>& search_values() const;
+
+  // returns an index of chunk whose first indexed segments are those of column_ids, or nullptr
+  static std::shared_ptr<const BaseIndex> find_index(const Chunk& chunk, const std::vector<ColumnID>& column_ids);
+
+  // returns the (up to two) ranges of index that contain the rows matching the predicate described above
+  static std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>> matching_ranges(
+      const BaseIndex& index, const ScanType scan_type, const std::vector<AllTypeVariant>& search_values);
+
+  // returns the rows in ranges, sorted by their offsets
+  static PosList positions(const ChunkID chunk_id,
+                           const std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>& ranges);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // evaluates the predicate row by row on a chunk without a suitable index
+  PosList _scan_sequentially(const Table& table, const ChunkID chunk_id) const;
+
+  const std::vector<ColumnID> _column_ids;
+  const ScanType _scan_type;
+  const std::vector<AllTypeVariant> _search_values;
+};
+
+}  // namespace opossum
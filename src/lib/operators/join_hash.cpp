@@ -0,0 +1,233 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The hash table of one partition of the build side should fit into a typical L2 cache
+constexpr auto L2_CACHE_SIZE = size_t{256 * 1024};
+
+// We never use more partitions than this, as the histograms and write cursors per chunk grow with the partition count
+constexpr auto MAX_RADIX_BITS = size_t{12};
+
+// Below this number of rows on the build side, we do not partition only to be able to join in parallel
+constexpr auto MIN_ROWS_FOR_PARALLEL_PROBE = size_t{10'000};
+
+// A value of the join column together with the position of its row in the input table
+template <typename T>
+struct PartitionedElement {
+  RowID row_id;
+  T value;
+};
+
+template <typename T>
+using Partition = std::vector<PartitionedElement<T>>;
+
+// std::hash is the identity for integers on common implementations, so its bits are mixed with the finalizer of
+// MurmurHash3 before the lowest bits are used as the partition
+template <typename T>
+uint64_t hash_value(const T& value) {
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb53ad34e495bull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+size_t ceil_log2(const size_t value) {
+  auto bits = size_t{0};
+  while ((size_t{1} << bits) < value) ++bits;
+  return bits;
+}
+
+template <typename T>
+class JoinHashImpl {
+ public:
+  JoinHashImpl(const std::shared_ptr<const Table>& left_table, const std::shared_ptr<const Table>& right_table,
+               const std::pair<ColumnID, ColumnID>& column_ids)
+      : _left_table(left_table), _right_table(right_table), _column_ids(column_ids) {}
+
+  // Returns pairs of PosLists (one per partition) whose entries at the same index are joined
+  std::pair<std::vector<std::shared_ptr<const PosList>>, std::vector<std::shared_ptr<const PosList>>> execute() {
+    // The smaller input is used to build the hash tables, the larger one probes them
+    const auto build_left = _left_table->row_count() <= _right_table->row_count();
+    const auto build_row_count = std::min(_left_table->row_count(), _right_table->row_count());
+    const auto radix_bits = _radix_bits(build_row_count);
+
+    // The inputs are partitioned one after the other because _partition already runs in parallel over the chunks.
+    // Nesting execute_in_parallel would oversubscribe the cores when no scheduler is set.
+    const auto left_partitions = _partition(*_left_table, _column_ids.first, radix_bits);
+    const auto right_partitions = _partition(*_right_table, _column_ids.second, radix_bits);
+
+    const auto partition_count = left_partitions.size();
+    auto left_pos_lists = std::vector<std::shared_ptr<const PosList>>(partition_count);
+    auto right_pos_lists = std::vector<std::shared_ptr<const PosList>>(partition_count);
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back([&, partition_id]() {
+        auto left_pos_list = std::make_shared<PosList>();
+        auto right_pos_list = std::make_shared<PosList>();
+        if (build_left) {
+          _build_and_probe(left_partitions[partition_id], right_partitions[partition_id], *left_pos_list,
+                           *right_pos_list);
+        } else {
+          _build_and_probe(right_partitions[partition_id], left_partitions[partition_id], *right_pos_list,
+                           *left_pos_list);
+        }
+        left_pos_lists[partition_id] = std::move(left_pos_list);
+        right_pos_lists[partition_id] = std::move(right_pos_list);
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return {std::move(left_pos_lists), std::move(right_pos_lists)};
+  }
+
+ protected:
+  static size_t _radix_bits(const size_t build_row_count) {
+    // Besides the element itself, a hash table entry stores the RowID in a vector and some bookkeeping
+    const auto build_size = build_row_count * (sizeof(PartitionedElement<T>) + sizeof(RowID) + 2 * sizeof(void*));
+    auto radix_bits = ceil_log2((build_size + L2_CACHE_SIZE - 1) / L2_CACHE_SIZE);
+
+    if (build_row_count >= MIN_ROWS_FOR_PARALLEL_PROBE) {
+      radix_bits = std::max(radix_bits, ceil_log2(std::thread::hardware_concurrency()));
+    }
+
+    return std::min(radix_bits, MAX_RADIX_BITS);
+  }
+
+  // Materializes the join column of table and scatters its values into 2^radix_bits partitions. Within a partition,
+  // the elements are ordered by their RowID.
+  static std::vector<Partition<T>> _partition(const Table& table, const ColumnID column_id, const size_t radix_bits) {
+    const auto partition_count = size_t{1} << radix_bits;
+    const auto partition_mask = partition_count - 1;
+    const auto chunk_count = table.chunk_count();
+
+    // First pass: materialize each chunk and count how many of its values belong to each partition
+    auto materialized_chunks = std::vector<std::vector<PartitionedElement<T>>>(chunk_count);
+    auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count, 0));
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        const auto& chunk = table.get_chunk(chunk_id);
+        if (chunk.size() == 0) return;
+
+        auto& elements = materialized_chunks[chunk_id];
+        auto& histogram = histograms[chunk_id];
+        elements.reserve(chunk.size());
+        segment_iterate<T>(*chunk.get_segment(column_id), [&](const auto& position) {
+          elements.push_back(PartitionedElement<T>{RowID{chunk_id, position.chunk_offset()}, position.value()});
+          ++histogram[hash_value(position.value()) & partition_mask];
+        });
+      });
+    }
+    execute_in_parallel(jobs);
+
+    // The prefix sums over the histograms are the positions at which each chunk starts writing into each partition
+    auto partitions = std::vector<Partition<T>>(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      auto offset = size_t{0};
+      for (auto& histogram : histograms) {
+        const auto count = histogram[partition_id];
+        histogram[partition_id] = offset;
+        offset += count;
+      }
+      partitions[partition_id].resize(offset);
+    }
+
+    // Second pass: scatter the materialized values. Every chunk writes to its own ranges, so no synchronization is
+    // needed.
+    jobs.clear();
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        auto& write_offsets = histograms[chunk_id];
+        for (auto& element : materialized_chunks[chunk_id]) {
+          const auto partition_id = hash_value(element.value) & partition_mask;
+          partitions[partition_id][write_offsets[partition_id]++] = std::move(element);
+        }
+        materialized_chunks[chunk_id] = {};
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return partitions;
+  }
+
+  static void _build_and_probe(const Partition<T>& build_partition, const Partition<T>& probe_partition,
+                               PosList& build_pos_list, PosList& probe_pos_list) {
+    if (build_partition.empty() || probe_partition.empty()) return;
+
+    auto hash_table = std::unordered_map<T, std::vector<RowID>>{};
+    hash_table.reserve(build_partition.size());
+    for (const auto& element : build_partition) {
+      hash_table[element.value].emplace_back(element.row_id);
+    }
+
+    for (const auto& element : probe_partition) {
+      const auto match = hash_table.find(element.value);
+      if (match == hash_table.end()) continue;
+
+      for (const auto& build_row_id : match->second) {
+        build_pos_list.emplace_back(build_row_id);
+        probe_pos_list.emplace_back(element.row_id);
+      }
+    }
+  }
+
+  const std::shared_ptr<const Table> _left_table;
+  const std::shared_ptr<const Table> _right_table;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const std::pair<ColumnID, ColumnID>& column_ids,
+                   const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {
+  Assert(scan_type == ScanType::OpEquals, "JoinHash only supports equi-joins.");
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(left_table != nullptr && right_table != nullptr, "Input tables must be defined.");
+
+  const auto& data_type = left_table->column_type(_column_ids.first);
+  Assert(data_type == right_table->column_type(_column_ids.second),
+         "JoinHash requires both join columns to have the same data type.");
+
+  auto left_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  auto right_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    std::tie(left_pos_lists, right_pos_lists) =
+        JoinHashImpl<ColumnDataType>{left_table, right_table, _column_ids}.execute();
+  });
+
+  return _create_output_table(left_pos_lists, right_pos_lists);
+}
+
+}  // namespace opossum
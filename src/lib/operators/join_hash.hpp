@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Equi-join that partitions both inputs by the hash of their join values (radix partitioning) and then joins each
+ * pair of partitions with a classic build-and-probe hash join.
+ *
+ * The number of partitions is chosen so that the hash table of a partition of the smaller input roughly fits into the
+ * L2 cache. Materialization and partitioning run in parallel per chunk, and the partitions are joined in parallel.
+ * The output contains one chunk per non-empty partition. Both join columns must have the same data type.
+ */
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,245 @@
+#include "join_index.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A value of the join column together with the position of its row in the input table
+template <typename T>
+struct MaterializedValue {
+  RowID row_id;
+  T value;
+};
+
+template <typename T>
+class JoinIndexImpl {
+ public:
+  JoinIndexImpl(const std::shared_ptr<const Table>& outer_table, const std::shared_ptr<const Table>& inner_table,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+      : _outer_table(outer_table), _inner_table(inner_table), _column_ids(column_ids), _scan_type(scan_type) {}
+
+  // Returns pairs of PosLists (one per inner chunk) whose entries at the same index are joined
+  std::pair<std::vector<std::shared_ptr<const PosList>>, std::vector<std::shared_ptr<const PosList>>> execute() {
+    _materialize_outer_values();
+
+    const auto chunk_count = _inner_table->chunk_count();
+    auto indexes = std::vector<std::shared_ptr<BaseIndex>>(chunk_count);
+    auto all_chunks_indexed = true;
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = _inner_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      const auto chunk_indexes = chunk.get_indexes({_column_ids.second});
+      if (!chunk_indexes.empty()) {
+        indexes[chunk_id] = chunk_indexes.front();
+      } else {
+        all_chunks_indexed = false;
+      }
+    }
+
+    if (!all_chunks_indexed) _prepare_probing();
+
+    auto outer_pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+    auto inner_pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        auto outer_pos_list = std::make_shared<PosList>();
+        auto inner_pos_list = std::make_shared<PosList>();
+
+        const auto& chunk = _inner_table->get_chunk(chunk_id);
+        if (indexes[chunk_id]) {
+          _join_with_index(chunk_id, *indexes[chunk_id], *outer_pos_list, *inner_pos_list);
+        } else if (chunk.size() > 0) {
+          _join_by_probing(chunk_id, *chunk.get_segment(_column_ids.second), *outer_pos_list, *inner_pos_list);
+        }
+
+        inner_pos_list->guarantee_single_chunk();
+        outer_pos_lists[chunk_id] = std::move(outer_pos_list);
+        inner_pos_lists[chunk_id] = std::move(inner_pos_list);
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return {std::move(outer_pos_lists), std::move(inner_pos_lists)};
+  }
+
+ protected:
+  void _materialize_outer_values() {
+    _outer_values.reserve(_outer_table->row_count());
+    for (ChunkID chunk_id{0}; chunk_id < _outer_table->chunk_count(); ++chunk_id) {
+      const auto& chunk = _outer_table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      segment_iterate<T>(*chunk.get_segment(_column_ids.first), [&](const auto& position) {
+        _outer_values.push_back(MaterializedValue<T>{RowID{chunk_id, position.chunk_offset()}, position.value()});
+      });
+    }
+  }
+
+  // Builds the structure that the rows of inner chunks without index are probed against
+  void _prepare_probing() {
+    if (_scan_type == ScanType::OpEquals) {
+      _outer_hash_table.reserve(_outer_values.size());
+      for (const auto& outer_value : _outer_values) {
+        _outer_hash_table[outer_value.value].emplace_back(outer_value.row_id);
+      }
+    } else {
+      _sorted_outer_values = _outer_values;
+      std::sort(_sorted_outer_values.begin(), _sorted_outer_values.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.value < rhs.value; });
+    }
+  }
+
+  void _join_with_index(const ChunkID chunk_id, const BaseIndex& index, PosList& outer_pos_list,
+                        PosList& inner_pos_list) const {
+    const auto emit = [&](const RowID& outer_row_id, BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+      for (; begin != end; ++begin) {
+        outer_pos_list.emplace_back(outer_row_id);
+        inner_pos_list.emplace_back(RowID{chunk_id, *begin});
+      }
+    };
+
+    for (const auto& outer_value : _outer_values) {
+      const auto search_values = std::vector<AllTypeVariant>{outer_value.value};
+      const auto lower_bound = index.lower_bound(search_values);
+      const auto upper_bound = index.upper_bound(search_values);
+
+      // The ScanType describes "outer_value scan_type inner_value"
+      switch (_scan_type) {
+        case ScanType::OpEquals:
+          emit(outer_value.row_id, lower_bound, upper_bound);
+          break;
+        case ScanType::OpNotEquals:
+          emit(outer_value.row_id, index.cbegin(), lower_bound);
+          emit(outer_value.row_id, upper_bound, index.cend());
+          break;
+        case ScanType::OpLessThan:
+          emit(outer_value.row_id, upper_bound, index.cend());
+          break;
+        case ScanType::OpLessThanEquals:
+          emit(outer_value.row_id, lower_bound, index.cend());
+          break;
+        case ScanType::OpGreaterThan:
+          emit(outer_value.row_id, index.cbegin(), lower_bound);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          emit(outer_value.row_id, index.cbegin(), upper_bound);
+          break;
+      }
+    }
+  }
+
+  void _join_by_probing(const ChunkID chunk_id, const BaseSegment& segment, PosList& outer_pos_list,
+                        PosList& inner_pos_list) const {
+    if (_scan_type == ScanType::OpEquals) {
+      segment_iterate<T>(segment, [&](const auto& position) {
+        const auto match = _outer_hash_table.find(position.value());
+        if (match == _outer_hash_table.end()) return;
+
+        for (const auto& outer_row_id : match->second) {
+          outer_pos_list.emplace_back(outer_row_id);
+          inner_pos_list.emplace_back(RowID{chunk_id, position.chunk_offset()});
+        }
+      });
+      return;
+    }
+
+    const auto begin = _sorted_outer_values.cbegin();
+    const auto end = _sorted_outer_values.cend();
+    segment_iterate<T>(segment, [&](const auto& position) {
+      const auto& inner_value = position.value();
+      const auto inner_row_id = RowID{chunk_id, position.chunk_offset()};
+
+      const auto emit = [&](auto outer_begin, const auto outer_end) {
+        for (; outer_begin != outer_end; ++outer_begin) {
+          outer_pos_list.emplace_back(outer_begin->row_id);
+          inner_pos_list.emplace_back(inner_row_id);
+        }
+      };
+
+      // The outer values less than the inner value are [begin, lower_bound), the equal ones [lower_bound, upper_bound)
+      const auto lower_bound = std::lower_bound(
+          begin, end, inner_value, [](const auto& element, const T& value) { return element.value < value; });
+      const auto upper_bound = std::upper_bound(
+          lower_bound, end, inner_value, [](const T& value, const auto& element) { return value < element.value; });
+
+      switch (_scan_type) {
+        case ScanType::OpNotEquals:
+          emit(begin, lower_bound);
+          emit(upper_bound, end);
+          break;
+        case ScanType::OpLessThan:
+          emit(begin, lower_bound);
+          break;
+        case ScanType::OpLessThanEquals:
+          emit(begin, upper_bound);
+          break;
+        case ScanType::OpGreaterThan:
+          emit(upper_bound, end);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          emit(lower_bound, end);
+          break;
+        case ScanType::OpEquals:
+          Fail("OpEquals is joined through the hash table.");
+      }
+    });
+  }
+
+  const std::shared_ptr<const Table> _outer_table;
+  const std::shared_ptr<const Table> _inner_table;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+
+  std::vector<MaterializedValue<T>> _outer_values;
+  std::unordered_map<T, std::vector<RowID>> _outer_hash_table;
+  std::vector<MaterializedValue<T>> _sorted_outer_values;
+};
+
+}  // namespace
+
+JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator> left,
+                     const std::shared_ptr<const AbstractOperator> right,
+                     const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+std::shared_ptr<const Table> JoinIndex::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(left_table != nullptr && right_table != nullptr, "Input tables must be defined.");
+
+  const auto& data_type = left_table->column_type(_column_ids.first);
+  Assert(data_type == right_table->column_type(_column_ids.second),
+         "JoinIndex requires both join columns to have the same data type.");
+
+  auto left_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  auto right_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    std::tie(left_pos_lists, right_pos_lists) =
+        JoinIndexImpl<ColumnDataType>{left_table, right_table, _column_ids, _scan_type}.execute();
+  });
+
+  return _create_output_table(left_pos_lists, right_pos_lists);
+}
+
+}  // namespace opossum
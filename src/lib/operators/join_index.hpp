@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Index nested-loop join. The left input is the outer input, the right input is the inner input. For every chunk of
+ * the inner input that has an index on exactly the join column, each outer row is looked up in the index. This makes
+ * the join cheap if a small outer input is joined with a large indexed table.
+ *
+ * Chunks without such an index (including all chunks of inner inputs that consist of ReferenceSegments) are joined by
+ * probing their rows against the materialized outer input instead: a hash table for OpEquals and a sorted vector for
+ * the other ScanTypes. Chunks are joined in parallel, and the output contains one chunk per inner chunk with matches.
+ * Both join columns must have the same data type.
+ */
+class JoinIndex : public AbstractJoinOperator {
+ public:
+  JoinIndex(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+            const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
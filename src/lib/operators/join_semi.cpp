@@ -0,0 +1,203 @@
+#include "join_semi.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Integer keys are stored in a bitmap if its range has at most this many bits per right row (plus a constant, so
+// that small inputs always use a bitmap)
+constexpr auto BITS_PER_ROW_FOR_BITMAP = uint64_t{8};
+constexpr auto MIN_BITMAP_SIZE = uint64_t{1} << 16;
+
+// The distinct values of the right join column
+template <typename T>
+class KeySet {
+ public:
+  explicit KeySet(const std::vector<T>& values) {
+    if constexpr (std::is_integral_v<T>) {
+      if (!values.empty()) {
+        const auto min_max = std::minmax_element(values.cbegin(), values.cend());
+        // computed without + 1, which would overflow for the full range of int64_t
+        const auto max_offset = static_cast<uint64_t>(*min_max.second) - static_cast<uint64_t>(*min_max.first);
+        if (max_offset < values.size() * BITS_PER_ROW_FOR_BITMAP + MIN_BITMAP_SIZE) {
+          _min = *min_max.first;
+          _max = *min_max.second;
+          _bitmap.resize(max_offset + 1, false);
+          for (const auto& value : values) {
+            _bitmap[static_cast<uint64_t>(value) - static_cast<uint64_t>(_min)] = true;
+          }
+          _use_bitmap = true;
+          return;
+        }
+      }
+    }
+    _hash_set.insert(values.cbegin(), values.cend());
+  }
+
+  bool contains(const T& value) const {
+    if constexpr (std::is_integral_v<T>) {
+      if (_use_bitmap) {
+        return value >= _min && value <= _max && _bitmap[static_cast<uint64_t>(value) - static_cast<uint64_t>(_min)];
+      }
+    }
+    return _hash_set.count(value) > 0;
+  }
+
+ protected:
+  bool _use_bitmap{false};
+  T _min{};
+  T _max{};
+  std::vector<bool> _bitmap;
+  std::unordered_set<T> _hash_set;
+};
+
+template <typename T>
+std::vector<T> materialize_column(const Table& table, const ColumnID column_id) {
+  auto values = std::vector<T>{};
+  values.reserve(table.row_count());
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    // Each distinct value of a dictionary only needs to be inserted once
+    if (const auto dictionary_segment =
+            std::dynamic_pointer_cast<const DictionarySegment<T>>(chunk.get_segment(column_id))) {
+      values.insert(values.end(), dictionary_segment->dictionary()->cbegin(), dictionary_segment->dictionary()->cend());
+      continue;
+    }
+    segment_iterate<T>(*chunk.get_segment(column_id),
+                       [&](const auto& position) { values.emplace_back(position.value()); });
+  }
+  return values;
+}
+
+// Returns the positions of the rows of segment whose value is (Semi) or is not (Anti) contained in key_set
+template <typename T>
+std::shared_ptr<PosList> probe(const BaseSegment& segment, const ChunkID chunk_id, const KeySet<T>& key_set,
+                               const SemiJoinMode mode) {
+  const auto keep_contained = mode == SemiJoinMode::Semi;
+  auto pos_list = std::make_shared<PosList>();
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    auto keep_value_id = std::vector<bool>(dictionary.size());
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      keep_value_id[value_id] = key_set.contains(dictionary[value_id]) == keep_contained;
+    }
+
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+        if (keep_value_id[value_ids[chunk_offset]]) pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    });
+  } else {
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (key_set.contains(position.value()) == keep_contained) {
+        pos_list->emplace_back(RowID{chunk_id, position.chunk_offset()});
+      }
+    });
+  }
+
+  pos_list->guarantee_single_chunk();
+  pos_list->guarantee_sorted();
+  return pos_list;
+}
+
+}  // namespace
+
+JoinSemi::JoinSemi(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const std::pair<ColumnID, ColumnID>& column_ids,
+                   const SemiJoinMode mode)
+    : AbstractStreamingOperator(left, right), _column_ids(column_ids), _mode(mode) {
+  Assert(left != nullptr && right != nullptr, "Input operators must be defined.");
+}
+
+const std::pair<ColumnID, ColumnID>& JoinSemi::column_ids() const { return _column_ids; }
+
+SemiJoinMode JoinSemi::mode() const { return _mode; }
+
+std::shared_ptr<Table> JoinSemi::prepare_streaming(const std::shared_ptr<const Table>& input_table) {
+  const auto right_table = _input_table_right();
+  Assert(right_table != nullptr, "Right input table must be defined.");
+
+  const auto& data_type = input_table->column_type(_column_ids.first);
+  Assert(data_type == right_table->column_type(_column_ids.second),
+         "JoinSemi requires both join columns to have the same data type.");
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto key_set = std::make_shared<const KeySet<ColumnDataType>>(
+        materialize_column<ColumnDataType>(*right_table, _column_ids.second));
+    _probe = [key_set, mode = _mode](const BaseSegment& segment, const ChunkID chunk_id) {
+      return probe(segment, chunk_id, *key_set, mode);
+    };
+  });
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  return output_table;
+}
+
+Chunk JoinSemi::process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+
+  Chunk chunk;
+  write_output_segments(chunk, input_table,
+                        input_chunk.size() == 0 ? std::make_shared<PosList>()
+                                                : _probe(*input_chunk.get_segment(_column_ids.first), chunk_id));
+  return chunk;
+}
+
+std::shared_ptr<const Table> JoinSemi::_on_execute() {
+  const auto left_table = _input_table_left();
+  Assert(left_table != nullptr, "Left input table must be defined.");
+
+  auto output_table = prepare_streaming(left_table);
+
+  const auto chunk_count = left_table->chunk_count();
+  auto output_chunks = std::vector<Chunk>(chunk_count);
+  auto jobs = std::vector<std::function<void()>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() { output_chunks[chunk_id] = process_chunk(left_table, chunk_id); });
+  }
+  execute_in_parallel(jobs);
+
+  // Don't add empty chunks
+  for (auto& chunk : output_chunks) {
+    if (chunk.size() > 0) output_table->emplace_chunk(std::move(chunk));
+  }
+
+  // In case no rows were selected, create one chunk with empty segments
+  if (output_table->row_count() == 0) {
+    Chunk chunk;
+    write_output_segments(chunk, left_table, std::make_shared<const PosList>());
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+enum class SemiJoinMode { Semi, Anti };
+
+/**
+ * Filters the left input by the values of the right input: a semi join outputs the rows of the left input whose value
+ * in column_ids.first occurs in column_ids.second of the right input (WHERE x IN (SELECT y ...) or EXISTS), an anti
+ * join outputs the rows whose value does not occur (NOT IN or NOT EXISTS). Unlike a regular join, every left row is
+ * output at most once, and the output only consists of the columns of the left input, as ReferenceSegments.
+ *
+ * The distinct values of the right input are collected into a set. For integer keys whose range is small compared to
+ * the number of right rows, the set is a bitmap over that range, otherwise a hash set. The left input is then probed
+ * chunk by chunk in parallel. For DictionarySegments, each dictionary entry is probed only once. Both join columns
+ * must have the same data type. In a pipeline, the set is built once and the left chunks are probed as they arrive.
+ */
+class JoinSemi : public AbstractStreamingOperator {
+ public:
+  JoinSemi(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const SemiJoinMode mode);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  SemiJoinMode mode() const;
+
+  std::shared_ptr<Table> prepare_streaming(const std::shared_ptr<const Table>& input_table) override;
+  Chunk process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const SemiJoinMode _mode;
+
+  // probes a segment of the left join column against the set of right values, created by prepare_streaming
+  std::function<std::shared_ptr<PosList>(const BaseSegment&, const ChunkID)> _probe;
+};
+
+}  // namespace opossum
@@ -0,0 +1,311 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Below this number of input rows, we do not partition only to be able to merge in parallel
+constexpr auto MIN_ROWS_FOR_PARALLEL_MERGE = size_t{10'000};
+
+// A value of the join column together with the position of its row in the input table
+template <typename T>
+struct MaterializedValue {
+  RowID row_id;
+  T value;
+};
+
+template <typename T>
+using MaterializedValues = std::vector<MaterializedValue<T>>;
+
+template <typename T>
+class JoinSortMergeImpl {
+ public:
+  JoinSortMergeImpl(const std::shared_ptr<const Table>& left_table, const std::shared_ptr<const Table>& right_table,
+                    const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+      : _left_table(left_table), _right_table(right_table), _column_ids(column_ids), _scan_type(scan_type) {}
+
+  // Returns pairs of PosLists (one per partition) whose entries at the same index are joined
+  std::pair<std::vector<std::shared_ptr<const PosList>>, std::vector<std::shared_ptr<const PosList>>> execute() {
+    // Both inputs are processed one after the other because each step already runs in parallel over the chunks or
+    // partitions of its input. Nesting execute_in_parallel would oversubscribe the cores when no scheduler is set.
+    auto left_chunks = _materialize_sorted_chunks(*_left_table, _column_ids.first);
+    auto right_chunks = _materialize_sorted_chunks(*_right_table, _column_ids.second);
+
+    const auto row_count = _left_table->row_count() + _right_table->row_count();
+    const auto partition_count =
+        row_count >= MIN_ROWS_FOR_PARALLEL_MERGE ? 2 * std::max(std::thread::hardware_concurrency(), 1u) : 1u;
+    const auto splitters = _choose_splitters(left_chunks, right_chunks, partition_count);
+
+    _left_partitions = _partition(left_chunks, splitters);
+    _right_partitions = _partition(right_chunks, splitters);
+
+    auto left_pos_lists = std::vector<std::shared_ptr<const PosList>>(_left_partitions.size());
+    auto right_pos_lists = std::vector<std::shared_ptr<const PosList>>(_left_partitions.size());
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(_left_partitions.size());
+    for (auto partition_id = size_t{0}; partition_id < _left_partitions.size(); ++partition_id) {
+      jobs.emplace_back([&, partition_id]() {
+        auto left_pos_list = std::make_shared<PosList>();
+        auto right_pos_list = std::make_shared<PosList>();
+        _merge_partition(partition_id, *left_pos_list, *right_pos_list);
+        left_pos_lists[partition_id] = std::move(left_pos_list);
+        right_pos_lists[partition_id] = std::move(right_pos_list);
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return {std::move(left_pos_lists), std::move(right_pos_lists)};
+  }
+
+ protected:
+  static bool _less_by_value(const MaterializedValue<T>& lhs, const MaterializedValue<T>& rhs) {
+    return lhs.value < rhs.value;
+  }
+
+  // Materializes the join column chunk by chunk and sorts each chunk by value, unless it is already sorted
+  static std::vector<MaterializedValues<T>> _materialize_sorted_chunks(const Table& table, const ColumnID column_id) {
+    const auto chunk_count = table.chunk_count();
+    auto chunks = std::vector<MaterializedValues<T>>(chunk_count);
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        const auto& chunk = table.get_chunk(chunk_id);
+        if (chunk.size() == 0) return;
+
+        auto& values = chunks[chunk_id];
+        values.reserve(chunk.size());
+        segment_iterate<T>(*chunk.get_segment(column_id), [&](const auto& position) {
+          values.push_back(MaterializedValue<T>{RowID{chunk_id, position.chunk_offset()}, position.value()});
+        });
+
+        if (!std::is_sorted(values.cbegin(), values.cend(), _less_by_value)) {
+          std::sort(values.begin(), values.end(), _less_by_value);
+        }
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return chunks;
+  }
+
+  // Chooses up to partition_count - 1 distinct values that split the values of both inputs into ranges of similar
+  // size. The values are sampled evenly from all sorted chunks.
+  static std::vector<T> _choose_splitters(const std::vector<MaterializedValues<T>>& left_chunks,
+                                          const std::vector<MaterializedValues<T>>& right_chunks,
+                                          const size_t partition_count) {
+    if (partition_count <= 1) return {};
+
+    auto samples = std::vector<T>{};
+    for (const auto& chunks : {&left_chunks, &right_chunks}) {
+      for (const auto& values : *chunks) {
+        if (values.empty()) continue;
+        for (auto sample_id = size_t{0}; sample_id < partition_count; ++sample_id) {
+          samples.emplace_back(values[sample_id * values.size() / partition_count].value);
+        }
+      }
+    }
+    std::sort(samples.begin(), samples.end());
+
+    auto splitters = std::vector<T>{};
+    for (auto splitter_id = size_t{1}; splitter_id < partition_count && !samples.empty(); ++splitter_id) {
+      const auto& sample = samples[splitter_id * samples.size() / partition_count];
+      // Equal values must end up in the same partition, so splitters have to be distinct
+      if (splitters.empty() || splitters.back() < sample) splitters.emplace_back(sample);
+    }
+    return splitters;
+  }
+
+  // Gathers the values of the sorted chunks into splitters.size() + 1 sorted partitions. Partition i holds all values
+  // v with splitters[i - 1] <= v < splitters[i].
+  static std::vector<MaterializedValues<T>> _partition(const std::vector<MaterializedValues<T>>& sorted_chunks,
+                                                       const std::vector<T>& splitters) {
+    const auto partition_count = splitters.size() + 1;
+    auto partitions = std::vector<MaterializedValues<T>>(partition_count);
+
+    const auto lower_bound = [](const MaterializedValues<T>& values, const T& value) {
+      return std::lower_bound(values.cbegin(), values.cend(), value,
+                              [](const auto& element, const T& search_value) { return element.value < search_value; });
+    };
+
+    auto jobs = std::vector<std::function<void()>>{};
+    jobs.reserve(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back([&, partition_id]() {
+        auto& partition = partitions[partition_id];
+
+        // Each chunk contributes a sorted run. run_bounds[i] is the offset at which the i-th run starts.
+        auto run_bounds = std::vector<size_t>{0};
+        for (const auto& values : sorted_chunks) {
+          const auto begin = partition_id == 0 ? values.cbegin() : lower_bound(values, splitters[partition_id - 1]);
+          const auto end =
+              partition_id + 1 == partition_count ? values.cend() : lower_bound(values, splitters[partition_id]);
+          if (begin == end) continue;
+
+          partition.insert(partition.end(), begin, end);
+          run_bounds.emplace_back(partition.size());
+        }
+
+        // Merge neighboring runs until a single sorted run remains
+        while (run_bounds.size() > 2) {
+          auto merged_run_bounds = std::vector<size_t>{0};
+          for (auto run_id = size_t{0}; run_id + 1 < run_bounds.size(); run_id += 2) {
+            if (run_id + 2 < run_bounds.size()) {
+              std::inplace_merge(partition.begin() + run_bounds[run_id], partition.begin() + run_bounds[run_id + 1],
+                                 partition.begin() + run_bounds[run_id + 2], _less_by_value);
+              merged_run_bounds.emplace_back(run_bounds[run_id + 2]);
+            } else {
+              merged_run_bounds.emplace_back(run_bounds[run_id + 1]);
+            }
+          }
+          run_bounds = std::move(merged_run_bounds);
+        }
+      });
+    }
+    execute_in_parallel(jobs);
+
+    return partitions;
+  }
+
+  // Returns true if all values of right partition right_partition_id match all values of left partition
+  // left_partition_id. For other partitions than the left one, either all or no values match.
+  bool _matches_other_partition(const size_t left_partition_id, const size_t right_partition_id) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return false;
+      case ScanType::OpNotEquals:
+        return true;
+      case ScanType::OpLessThan:
+      case ScanType::OpLessThanEquals:
+        return right_partition_id > left_partition_id;
+      case ScanType::OpGreaterThan:
+      case ScanType::OpGreaterThanEquals:
+        return right_partition_id < left_partition_id;
+    }
+    Fail("Unsupported ScanType.");
+    return false;
+  }
+
+  static void _emit_combinations(const MaterializedValues<T>& left_values, const size_t left_begin,
+                                 const size_t left_end, const MaterializedValues<T>& right_values,
+                                 const size_t right_begin, const size_t right_end, PosList& left_pos_list,
+                                 PosList& right_pos_list) {
+    for (auto left_index = left_begin; left_index < left_end; ++left_index) {
+      for (auto right_index = right_begin; right_index < right_end; ++right_index) {
+        left_pos_list.emplace_back(left_values[left_index].row_id);
+        right_pos_list.emplace_back(right_values[right_index].row_id);
+      }
+    }
+  }
+
+  // Joins left partition partition_id with all right partitions
+  void _merge_partition(const size_t partition_id, PosList& left_pos_list, PosList& right_pos_list) const {
+    const auto& left_values = _left_partitions[partition_id];
+    const auto& right_values = _right_partitions[partition_id];
+
+    // [lower, upper) is the range of right_values that equals the value of the current left run. Both bounds only
+    // move forward, as the left runs are visited in ascending order.
+    auto lower = size_t{0};
+    auto upper = size_t{0};
+
+    auto left_run_end = size_t{0};
+    for (auto left_run_begin = size_t{0}; left_run_begin < left_values.size(); left_run_begin = left_run_end) {
+      const auto& value = left_values[left_run_begin].value;
+      left_run_end = left_run_begin + 1;
+      while (left_run_end < left_values.size() && !(value < left_values[left_run_end].value)) ++left_run_end;
+
+      while (lower < right_values.size() && right_values[lower].value < value) ++lower;
+      upper = std::max(upper, lower);
+      while (upper < right_values.size() && !(value < right_values[upper].value)) ++upper;
+
+      const auto emit = [&](const MaterializedValues<T>& values, const size_t begin, const size_t end) {
+        _emit_combinations(left_values, left_run_begin, left_run_end, values, begin, end, left_pos_list,
+                           right_pos_list);
+      };
+
+      switch (_scan_type) {
+        case ScanType::OpEquals:
+          emit(right_values, lower, upper);
+          break;
+        case ScanType::OpNotEquals:
+          emit(right_values, 0, lower);
+          emit(right_values, upper, right_values.size());
+          break;
+        case ScanType::OpLessThan:
+          emit(right_values, upper, right_values.size());
+          break;
+        case ScanType::OpLessThanEquals:
+          emit(right_values, lower, right_values.size());
+          break;
+        case ScanType::OpGreaterThan:
+          emit(right_values, 0, lower);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          emit(right_values, 0, upper);
+          break;
+      }
+
+      for (auto right_partition_id = size_t{0}; right_partition_id < _right_partitions.size(); ++right_partition_id) {
+        if (right_partition_id == partition_id || !_matches_other_partition(partition_id, right_partition_id)) {
+          continue;
+        }
+        const auto& other_values = _right_partitions[right_partition_id];
+        emit(other_values, 0, other_values.size());
+      }
+    }
+  }
+
+  const std::shared_ptr<const Table> _left_table;
+  const std::shared_ptr<const Table> _right_table;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+
+  std::vector<MaterializedValues<T>> _left_partitions;
+  std::vector<MaterializedValues<T>> _right_partitions;
+};
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(left_table != nullptr && right_table != nullptr, "Input tables must be defined.");
+
+  const auto& data_type = left_table->column_type(_column_ids.first);
+  Assert(data_type == right_table->column_type(_column_ids.second),
+         "JoinSortMerge requires both join columns to have the same data type.");
+
+  auto left_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  auto right_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    std::tie(left_pos_lists, right_pos_lists) =
+        JoinSortMergeImpl<ColumnDataType>{left_table, right_table, _column_ids, _scan_type}.execute();
+  });
+
+  return _create_output_table(left_pos_lists, right_pos_lists);
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Join that sorts both inputs by their join values and then merges them. Unlike JoinHash, it supports all ScanTypes,
+ * which makes it the join of choice for range and band joins. It is also cheap for inputs whose chunks are already
+ * sorted, as sorted chunks are detected and not sorted again.
+ *
+ * Both inputs are materialized and sorted per chunk in parallel. Then, splitter values sampled from both inputs divide
+ * the value domain into ranges, and each range is gathered from the sorted chunks into a sorted partition, again in
+ * parallel. As the ranges are the same for both inputs, left partition i only has to be merged with right partition i.
+ * For ScanTypes other than OpEquals, it additionally matches all rows of some of the other right partitions (e.g., all
+ * partitions with larger values for OpLessThan), which does not require comparisons. The output contains one chunk per
+ * left partition. Both join columns must have the same data type.
+ */
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
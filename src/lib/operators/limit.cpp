@@ -0,0 +1,61 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "output_segments.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const uint64_t row_count)
+    : AbstractOperator(in), _row_count(row_count) {
+  Assert(in != nullptr, "Input operator must be defined.");
+}
+
+uint64_t Limit::row_count() const { return _row_count; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  auto remaining_row_count = _row_count;
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count() && remaining_row_count > 0; ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id).size();
+    if (chunk_size == 0) continue;
+
+    const auto output_chunk_size = static_cast<ChunkOffset>(std::min<uint64_t>(chunk_size, remaining_row_count));
+    remaining_row_count -= output_chunk_size;
+
+    auto pos_list = std::make_shared<PosList>(output_chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < output_chunk_size; ++chunk_offset) {
+      (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+    pos_list->guarantee_single_chunk();
+    pos_list->guarantee_sorted();
+
+    Chunk chunk;
+    write_output_segments(chunk, input_table, pos_list);
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  // In case there are no rows, create one chunk with empty segments
+  if (output_table->row_count() == 0) {
+    Chunk chunk;
+    write_output_segments(chunk, input_table, std::make_shared<const PosList>());
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
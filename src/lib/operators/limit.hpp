@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Forwards the first row_count rows of its input (or all rows, if the input has fewer). The output references the
+ * input rows, one output chunk per input chunk that contributes rows. Chunks after the last required row are never
+ * accessed, so the cost only depends on row_count, not on the size of the input.
+ */
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const uint64_t row_count);
+
+  uint64_t row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const uint64_t _row_count;
+};
+
+}  // namespace opossum
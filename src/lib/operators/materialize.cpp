@@ -0,0 +1,163 @@
+#include "materialize.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of positions the prefetched address is ahead of the gathered one
+constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+// Writes load(chunk_offset) to output for the positions [begin, end) of pos_list, prefetching the address returned
+// by prefetch_address for the position PREFETCH_DISTANCE ahead.
+template <typename T, typename Load, typename PrefetchAddress>
+void gather(const PosList& pos_list, const size_t begin, const size_t end, T* output, const Load& load,
+            const PrefetchAddress& prefetch_address) {
+  auto index = begin;
+  for (; index + PREFETCH_DISTANCE < end; ++index) {
+    __builtin_prefetch(prefetch_address(pos_list[index + PREFETCH_DISTANCE].chunk_offset));
+    output[index] = load(pos_list[index].chunk_offset);
+  }
+  for (; index < end; ++index) {
+    output[index] = load(pos_list[index].chunk_offset);
+  }
+}
+
+// gathers the values referenced by the positions [begin, end), which all reference the same segment, into output
+template <typename T>
+void gather_run(const BaseSegment& referenced_segment, const PosList& pos_list, const size_t begin, const size_t end,
+                T* output) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&referenced_segment)) {
+    const auto& values = value_segment->values();
+    const auto first_offset = pos_list[begin].chunk_offset;
+    auto contiguous = true;
+    for (auto index = begin; index < end && contiguous; ++index) {
+      contiguous = pos_list[index].chunk_offset == first_offset + (index - begin);
+    }
+    if (contiguous) {
+      std::copy(values.cbegin() + first_offset, values.cbegin() + first_offset + (end - begin), output + begin);
+      return;
+    }
+
+    gather(
+        pos_list, begin, end, output, [&](const ChunkOffset chunk_offset) { return values[chunk_offset]; },
+        [&](const ChunkOffset chunk_offset) { return &values[chunk_offset]; });
+    return;
+  }
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&referenced_segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      gather(
+          pos_list, begin, end, output,
+          [&](const ChunkOffset chunk_offset) { return dictionary[value_ids[chunk_offset]]; },
+          [&](const ChunkOffset chunk_offset) { return &value_ids[chunk_offset]; });
+    });
+    return;
+  }
+
+  Fail("ReferenceSegment must reference a ValueSegment or DictionarySegment of same type.");
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> materialize_segment(const std::shared_ptr<BaseSegment>& segment) {
+  if (std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) return segment;
+
+  auto values = std::vector<T>(segment->size());
+
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      for (auto chunk_offset = size_t{0}; chunk_offset < values.size(); ++chunk_offset) {
+        values[chunk_offset] = dictionary[value_ids[chunk_offset]];
+      }
+    });
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+  Assert(reference_segment, "Unknown segment type.");
+
+  const auto& table = *reference_segment->referenced_table();
+  const auto column_id = reference_segment->referenced_column_id();
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto single_chunk = pos_list.references_single_chunk();
+
+  // Split the positions into runs that reference the same chunk. Our operators group their positions by chunk, so
+  // there are usually few runs.
+  auto begin = size_t{0};
+  while (begin < pos_list.size()) {
+    const auto chunk_id = pos_list[begin].chunk_id;
+    auto end = single_chunk ? pos_list.size() : begin + 1;
+    while (end < pos_list.size() && pos_list[end].chunk_id == chunk_id) ++end;
+
+    const auto referenced_segment = table.get_chunk(chunk_id).get_segment(column_id);
+    gather_run(*referenced_segment, pos_list, begin, end, values.data());
+    begin = end;
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+}  // namespace
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {
+  Assert(in != nullptr, "Input operator must be defined.");
+}
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  const auto column_count = input_table->column_count();
+
+  // output_segments[chunk_id][column_id]
+  auto output_segments = std::vector<std::vector<std::shared_ptr<BaseSegment>>>(
+      chunk_count, std::vector<std::shared_ptr<BaseSegment>>(column_count));
+
+  auto jobs = std::vector<std::function<void()>>{};
+  jobs.reserve(column_count);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    jobs.emplace_back([&, column_id]() {
+      resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto segment = input_table->get_chunk(chunk_id).get_segment(column_id);
+          output_segments[chunk_id][column_id] = materialize_segment<ColumnDataType>(segment);
+        }
+      });
+    });
+  }
+  execute_in_parallel(jobs);
+
+  for (auto& segments : output_segments) {
+    Chunk chunk;
+    for (auto& segment : segments) {
+      chunk.add_segment(std::move(segment));
+    }
+    output_table->emplace_chunk(std::move(chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
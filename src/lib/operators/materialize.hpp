@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Converts all segments of its input into ValueSegments, e.g., to deliver query results or to pass real values to
+ * consumers that would otherwise access ReferenceSegments row by row via operator[] and AllTypeVariants.
+ * ValueSegments of the input are forwarded without copying, DictionarySegments are decoded.
+ *
+ * ReferenceSegments are gathered in typed loops: the position list is split into runs of positions that reference
+ * the same chunk, and the referenced segment is resolved once per run. Within a run, the values (or value ids) of
+ * upcoming positions are prefetched, as random accesses into large segments usually miss the cache. Runs that cover
+ * a gap-free range of offsets are copied as a whole. The columns are materialized in parallel.
+ */
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
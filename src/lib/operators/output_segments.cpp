@@ -0,0 +1,144 @@
+#include "output_segments.hpp"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the ids of all input chunks that pos_list references, in ascending order
+std::vector<ChunkID> referenced_chunk_ids(const PosList& pos_list, const ChunkID chunk_count) {
+  if (pos_list.empty()) return {};
+  if (pos_list.references_single_chunk()) return {pos_list.common_chunk_id()};
+
+  auto is_referenced = std::vector<bool>(chunk_count, false);
+  for (const auto& row_id : pos_list) {
+    is_referenced[row_id.chunk_id] = true;
+  }
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (is_referenced[chunk_id]) chunk_ids.emplace_back(chunk_id);
+  }
+  return chunk_ids;
+}
+
+// Replaces each position in pos_list by the position it refers to in the input's position lists. input_pos_lists
+// holds the position list of the input segment for each chunk in chunk_ids.
+std::shared_ptr<const PosList> resolve_pos_list(const PosList& pos_list, const std::vector<ChunkID>& chunk_ids,
+                                                const std::vector<std::shared_ptr<const PosList>>& input_pos_lists,
+                                                const ChunkID chunk_count) {
+  auto resolved_pos_list = std::make_shared<PosList>();
+  resolved_pos_list->reserve(pos_list.size());
+
+  if (chunk_ids.size() == 1) {
+    // We only pick from a single input position list, so its guarantees are inherited
+    const auto& input_pos_list = *input_pos_lists.front();
+    for (const auto& row_id : pos_list) {
+      resolved_pos_list->emplace_back(input_pos_list[row_id.chunk_offset]);
+    }
+
+    if (input_pos_list.references_single_chunk()) resolved_pos_list->guarantee_single_chunk();
+    if (pos_list.is_sorted() && input_pos_list.is_sorted()) resolved_pos_list->guarantee_sorted();
+    return resolved_pos_list;
+  }
+
+  auto input_pos_list_by_chunk = std::vector<const PosList*>(chunk_count, nullptr);
+  for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+    input_pos_list_by_chunk[chunk_ids[index]] = input_pos_lists[index].get();
+  }
+
+  for (const auto& row_id : pos_list) {
+    resolved_pos_list->emplace_back((*input_pos_list_by_chunk[row_id.chunk_id])[row_id.chunk_offset]);
+  }
+  return resolved_pos_list;
+}
+
+// Copies the values of column_id at the positions in pos_list into a ValueSegment. This is used for columns whose
+// segments reference different tables or columns (or only some of them are ReferenceSegments), e.g., after a UnionAll
+// of two scans. A single ReferenceSegment cannot express where these rows are stored.
+std::shared_ptr<BaseSegment> materialize_positions(const Table& input_table, const ColumnID column_id,
+                                                   const PosList& pos_list) {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(input_table.column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto values = std::vector<ColumnDataType>{};
+    values.reserve(pos_list.size());
+    for (const auto& row_id : pos_list) {
+      const auto& input_segment = *input_table.get_chunk(row_id.chunk_id).get_segment(column_id);
+      values.emplace_back(type_cast<ColumnDataType>(input_segment[row_id.chunk_offset]));
+    }
+    segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+  });
+  return segment;
+}
+
+}  // namespace
+
+void write_output_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                           const std::shared_ptr<const PosList>& pos_list) {
+  const auto chunk_count = input_table->chunk_count();
+  const auto chunk_ids = referenced_chunk_ids(*pos_list, chunk_count);
+
+  // Resolved position lists by the input position lists they were resolved through. This way, columns sharing their
+  // position lists in the input share them in the output, too.
+  auto resolved_pos_lists = std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<const PosList>>{};
+
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    // Tables without rows might consist of a single chunk without segments
+    const auto& first_chunk = input_table->get_chunk(chunk_ids.empty() ? ChunkID{0} : chunk_ids.front());
+    const auto first_reference_segment =
+        first_chunk.column_count() > column_id
+            ? std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk.get_segment(column_id))
+            : nullptr;
+
+    auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+    input_pos_lists.reserve(chunk_ids.size());
+    auto data_segment_count = size_t{0};
+    auto references_single_column = true;
+    for (const auto& chunk_id : chunk_ids) {
+      const auto reference_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(input_table->get_chunk(chunk_id).get_segment(column_id));
+      if (!reference_segment) {
+        ++data_segment_count;
+        continue;
+      }
+      if (!first_reference_segment ||
+          reference_segment->referenced_table() != first_reference_segment->referenced_table() ||
+          reference_segment->referenced_column_id() != first_reference_segment->referenced_column_id()) {
+        references_single_column = false;
+      }
+      input_pos_lists.emplace_back(reference_segment->pos_list());
+    }
+
+    if (data_segment_count == chunk_ids.size() && !first_reference_segment) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      continue;
+    }
+
+    if (data_segment_count > 0 || !references_single_column) {
+      output_chunk.add_segment(materialize_positions(*input_table, column_id, *pos_list));
+      continue;
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list) resolved_pos_list = resolve_pos_list(*pos_list, chunk_ids, input_pos_lists, chunk_count);
+
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(first_reference_segment->referenced_table(),
+                                                                first_reference_segment->referenced_column_id(),
+                                                                resolved_pos_list));
+  }
+}
+
+}  // namespace opossum
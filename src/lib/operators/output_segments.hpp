@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Adds one ReferenceSegment per column of input_table to output_chunk. The RowIDs in pos_list refer to rows of
+ * input_table.
+ *
+ * If a column of input_table consists of ReferenceSegments itself, the positions are resolved through the position
+ * lists of these segments. This way, the output always references the table that actually stores the data and we
+ * never create chains of ReferenceSegments. Columns that share their position lists in the input (e.g., all columns
+ * of a table scan's output) also share the resolved position list in the output.
+ *
+ * If the segments of a column referenced by pos_list are of different kinds, i.e., only some of them are
+ * ReferenceSegments or they reference different tables or columns (as after a UnionAll of two scans), no single
+ * ReferenceSegment can point to the rows. The values of such a column are copied into a ValueSegment instead.
+ */
+void write_output_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                           const std::shared_ptr<const PosList>& pos_list);
+
+}  // namespace opossum
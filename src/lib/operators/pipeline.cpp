@@ -0,0 +1,176 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "abstract_streaming_operator.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Operators only hold their inputs as const, but the inputs still have to be executed
+std::shared_ptr<AbstractOperator> mutable_operator(const std::shared_ptr<const AbstractOperator>& op) {
+  return std::const_pointer_cast<AbstractOperator>(op);
+}
+
+// returns a table with the columns of schema that consists of chunk, so that the next operator can process it
+std::shared_ptr<const Table> wrap_chunk(const Table& schema, Chunk chunk) {
+  auto table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < schema.column_count(); ++column_id) {
+    table->add_column_definition(schema.column_name(column_id), schema.column_type(column_id));
+  }
+  table->emplace_chunk(std::move(chunk));
+  return table;
+}
+
+// Replaces the ReferenceSegments of chunk that reference one of the tables created by wrap_chunk by ValueSegments
+Chunk materialize_wrapped_references(const Chunk& chunk, const Table& schema,
+                                     const std::vector<std::shared_ptr<const Table>>& wrapped_tables) {
+  Chunk output_chunk;
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (!reference_segment || std::find(wrapped_tables.cbegin(), wrapped_tables.cend(),
+                                        reference_segment->referenced_table()) == wrapped_tables.cend()) {
+      output_chunk.add_segment(segment);
+      continue;
+    }
+
+    resolve_data_type(schema.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto values = std::vector<ColumnDataType>{};
+      values.reserve(segment->size());
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) { values.emplace_back(position.value()); });
+      output_chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+    });
+  }
+  return output_chunk;
+}
+
+// returns a chunk with empty ValueSegments for the columns of schema
+Chunk empty_chunk(const Table& schema) {
+  Chunk chunk;
+  for (ColumnID column_id{0}; column_id < schema.column_count(); ++column_id) {
+    chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(schema.column_type(column_id)));
+  }
+  return chunk;
+}
+
+void execute_operator(const std::shared_ptr<AbstractOperator>& op);
+
+// Pushes the chunks of source through stages (ordered from the source upwards) and into sink, if there is one
+void execute_pipeline(const std::shared_ptr<AbstractOperator>& source,
+                      const std::vector<std::shared_ptr<AbstractStreamingOperator>>& stages,
+                      const std::shared_ptr<AbstractSinkOperator>& sink) {
+  execute_operator(source);
+  for (const auto& stage : stages) {
+    if (stage->input_right()) execute_operator(mutable_operator(stage->input_right()));
+  }
+
+  const auto source_table = source->get_output();
+  Assert(source_table != nullptr, "Source of the pipeline must have an output.");
+
+  // The columns of the input of each stage and of the output of the last one, which becomes its output table
+  auto schemas = std::vector<std::shared_ptr<const Table>>{source_table};
+  auto output_table = std::shared_ptr<Table>{};
+  for (const auto& stage : stages) {
+    output_table = stage->prepare_streaming(schemas.back());
+    schemas.emplace_back(output_table);
+  }
+  if (sink) sink->prepare_sink(schemas.back());
+
+  const auto chunk_count = source_table->chunk_count();
+  auto output_chunks = std::vector<Chunk>(sink ? 0 : chunk_count);
+  auto jobs = std::vector<std::function<void()>>{};
+  auto node_ids = std::vector<NodeID>{};
+  for (ChunkID source_chunk_id{0}; source_chunk_id < chunk_count; ++source_chunk_id) {
+    const auto& source_chunk = source_table->get_chunk(source_chunk_id);
+    if (source_chunk.size() == 0) continue;
+
+    node_ids.emplace_back(source_chunk.node_id());
+    jobs.emplace_back([&, source_chunk_id]() {
+      // The chunk that the next operator processes, as chunk_id of table
+      auto table = source_table;
+      auto chunk_id = source_chunk_id;
+      auto wrapped_tables = std::vector<std::shared_ptr<const Table>>{};
+
+      for (auto stage_index = size_t{0}; stage_index < stages.size(); ++stage_index) {
+        auto chunk = stages[stage_index]->process_chunk(table, chunk_id);
+        if (chunk.size() == 0) return;
+
+        table = wrap_chunk(*schemas[stage_index + 1], std::move(chunk));
+        chunk_id = ChunkID{0};
+        wrapped_tables.emplace_back(table);
+      }
+
+      if (sink) {
+        sink->consume_chunk(table, chunk_id);
+        return;
+      }
+
+      auto& output_chunk = output_chunks[source_chunk_id];
+      output_chunk = materialize_wrapped_references(table->get_chunk(chunk_id), *schemas.back(), wrapped_tables);
+      output_chunk.set_node_id(source_table->get_chunk(source_chunk_id).node_id());
+    });
+  }
+  execute_in_parallel(jobs, node_ids);
+
+  if (sink) {
+    sink->finish_sink();
+    return;
+  }
+
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk.size() > 0) output_table->emplace_chunk(std::move(output_chunk));
+  }
+  if (output_table->row_count() == 0) output_table->emplace_chunk(empty_chunk(*output_table));
+  stages.back()->set_streamed_output(output_table);
+}
+
+void execute_operator(const std::shared_ptr<AbstractOperator>& op) {
+  if (op->get_output()) return;
+
+  // Collect the streaming operators that consume the output of each other, starting at op (or at the input of op, if
+  // op is a sink)
+  const auto sink = std::dynamic_pointer_cast<AbstractSinkOperator>(op);
+  auto stages = std::vector<std::shared_ptr<AbstractStreamingOperator>>{};
+  auto source = sink ? mutable_operator(op->input_left()) : op;
+  while (source) {
+    const auto stage = std::dynamic_pointer_cast<AbstractStreamingOperator>(source);
+    if (!stage || stage->get_output()) break;
+    stages.emplace_back(stage);
+    source = mutable_operator(stage->input_left());
+  }
+  std::reverse(stages.begin(), stages.end());
+
+  if (stages.empty() && !sink) {
+    // op breaks pipelines, e.g., a sort. Its inputs are pipelines of their own.
+    for (const auto& input : {op->input_left(), op->input_right()}) {
+      if (input) execute_operator(mutable_operator(input));
+    }
+    op->execute();
+    return;
+  }
+
+  execute_pipeline(source, stages, sink);
+}
+
+}  // namespace
+
+void execute_pipelined(const std::shared_ptr<AbstractOperator>& root) { execute_operator(root); }
+
+}  // namespace opossum
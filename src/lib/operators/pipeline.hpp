@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Executes the operator tree below root (including root) in pipelines instead of operator by operator.
+ *
+ * A pipeline starts at a source, i.e., an operator that is executed as usual (or was executed already), and continues
+ * with the chain of AbstractStreamingOperators above it, each consuming the output of the previous one. If the chain
+ * ends in an AbstractSinkOperator, that operator is part of the pipeline as well. Each chunk of the source is pushed
+ * through all operators of the pipeline by one job, before the next chunk is processed. The jobs run in parallel on
+ * the nodes of their source chunks. This way, intermediate results only exist for the chunks that are currently
+ * processed, and they are likely still in the cache when the next operator reads them.
+ *
+ * Only the last operator of a pipeline gets an output, the outputs of the other operators of the pipeline stay
+ * empty. Operators that are inputs of several operators should therefore be executed before. Output chunks keep the
+ * node of the source chunk they were computed from. Rows that the pipeline computed itself (e.g., the results of
+ * expressions) are copied into ValueSegments at the end of the pipeline, as their intermediate chunks do not persist.
+ */
+void execute_pipelined(const std::shared_ptr<AbstractOperator>& root);
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include "projection.hpp"
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<std::shared_ptr<AbstractExpression>>& expressions)
+    : AbstractStreamingOperator(in), _expressions(expressions) {
+  Assert(in != nullptr, "Input operator must be defined.");
+  Assert(!expressions.empty(), "Projection requires at least one expression.");
+  for (const auto& expression : expressions) {
+    Assert(expression != nullptr, "Expressions must be defined.");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& Projection::expressions() const { return _expressions; }
+
+std::shared_ptr<Table> Projection::prepare_streaming(const std::shared_ptr<const Table>& input_table) {
+  // Resolving names and data types also checks the expressions (e.g., for arithmetic on strings) before any work is
+  // done
+  auto output_table = std::make_shared<Table>();
+  for (const auto& expression : _expressions) {
+    output_table->add_column_definition(expression->description(*input_table), expression->data_type(*input_table));
+  }
+  return output_table;
+}
+
+Chunk Projection::process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  const auto evaluator = ExpressionEvaluator{input_table, chunk_id};
+
+  Chunk output_chunk;
+  for (const auto& expression : _expressions) {
+    if (expression->type() == ExpressionType::Column) {
+      output_chunk.add_segment(input_chunk.get_segment(static_cast<const ColumnExpression&>(*expression).column_id()));
+    } else {
+      output_chunk.add_segment(evaluator.evaluate_to_segment(*expression));
+    }
+  }
+  return output_chunk;
+}
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  auto output_table = prepare_streaming(input_table);
+
+  const auto chunk_count = input_table->chunk_count();
+  auto output_chunks = std::vector<Chunk>(chunk_count);
+
+  auto jobs = std::vector<std::function<void()>>{};
+  auto node_ids = std::vector<NodeID>{};
+  jobs.reserve(chunk_count);
+  node_ids.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    node_ids.emplace_back(input_table->get_chunk(chunk_id).node_id());
+    jobs.emplace_back([&, chunk_id]() {
+      // The output chunk stays on the node of the input chunk, so that its consumers run there as well
+      output_chunks[chunk_id] = process_chunk(input_table, chunk_id);
+      output_chunks[chunk_id].set_node_id(node_ids[chunk_id]);
+    });
+  }
+  execute_in_parallel(jobs, node_ids);
+
+  for (auto& output_chunk : output_chunks) {
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class Table;
+
+/**
+ * Computes one output column per expression, e.g., price * (1 - discount), for all rows of its input. The output
+ * columns are named by the descriptions of the expressions.
+ *
+ * The expressions are evaluated chunk by chunk by the ExpressionEvaluator, which writes the results into
+ * ValueSegments of the data type of the expression. Chunks are processed in parallel. Columns that are simply passed
+ * through (ColumnExpressions) are not evaluated: the segment of the input chunk is forwarded, which also keeps
+ * DictionarySegments and ReferenceSegments intact.
+ */
+class Projection : public AbstractStreamingOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in,
+             const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& expressions() const;
+
+  std::shared_ptr<Table> prepare_streaming(const std::shared_ptr<const Table>& input_table) override;
+  Chunk process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>> _expressions;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -41,6 +42,11 @@ class ContinuousIndexFetcher {
 
   size_t current() { return _current; }
 
+  /**
+   * Returns the index of the current element within the interval, which equals current().
+   */
+  size_t position() { return _current; }
+
  protected:
   size_t _current;
 };
@@ -72,6 +78,11 @@ class PosListIndexFetcher {
    */
   size_t current() { return _pos_list[_current].chunk_offset; }
 
+  /**
+   * Returns the current index within the PosList.
+   */
+  size_t position() { return _current; }
+
  protected:
   size_t _current;
   const PosList& _pos_list;
@@ -112,13 +123,12 @@ class AbstractSegmentScanner : private Noncopyable {
 
   /**
    * Scans segment and returns a PosList with all RowsIds for which the compare function
-   * yields true.
-   * chunk_id is ignored if segment is a ReferenceSegment
+   * yields true. The RowIDs refer to chunk chunk_id of the scanned table, even if segment is a ReferenceSegment.
    */
   PosList scan(const ChunkID chunk_id, const std::shared_ptr<BaseSegment>& segment, const T& cmp_value) {
     // Determine dynamic type of segment and forward to specialized scan implementation.
     if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
-      return scan(*reference_segment, cmp_value);
+      return scan(chunk_id, *reference_segment, cmp_value);
     } else if (const auto& value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment)) {
       return scan(chunk_id, *value_segment, cmp_value);
     } else if (const auto& dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
@@ -134,7 +144,10 @@ class AbstractSegmentScanner : private Noncopyable {
    */
   PosList scan(const ChunkID chunk_id, const DictionarySegment<T>& segment, const T& cmp_value) {
     auto index_fetcher = ContinuousIndexFetcher(0, segment.size());
-    return this->template scan<ContinuousIndexFetcher>(chunk_id, segment, cmp_value, index_fetcher);
+    auto pos_list = this->template scan<ContinuousIndexFetcher>(chunk_id, segment, cmp_value, index_fetcher);
+    pos_list.guarantee_single_chunk();
+    pos_list.guarantee_sorted();
+    return pos_list;
   }
 
   /**
@@ -143,14 +156,18 @@ class AbstractSegmentScanner : private Noncopyable {
    */
   PosList scan(const ChunkID chunk_id, const ValueSegment<T>& segment, const T& cmp_value) {
     auto index_fetcher = ContinuousIndexFetcher(0, segment.size());
-    return this->template scan<ContinuousIndexFetcher>(chunk_id, segment, cmp_value, index_fetcher);
+    auto pos_list = this->template scan<ContinuousIndexFetcher>(chunk_id, segment, cmp_value, index_fetcher);
+    pos_list.guarantee_single_chunk();
+    pos_list.guarantee_sorted();
+    return pos_list;
   }
 
   /**
    * Scans a ReferenceSegment and returns a PosList with all RowsIds for which the compare function
-   * yields true.
+   * yields true. The RowIDs are offsets within the ReferenceSegment, not within the referenced table. Resolving them
+   * to the referenced table is up to the caller (see write_output_segments).
    */
-  PosList scan(const ReferenceSegment& segment, const T& cmp_value) {
+  PosList scan(const ChunkID chunk_id, const ReferenceSegment& segment, const T& cmp_value) {
     const auto& pos_list = *segment.pos_list();
     if (pos_list.empty()) {
       return PosList{};
@@ -160,6 +177,19 @@ class AbstractSegmentScanner : private Noncopyable {
     // PosList to hold the selected RowIDs
     PosList result;
 
+    // The offsets are visited in ascending order
+    result.guarantee_single_chunk();
+    result.guarantee_sorted();
+
+    // If all positions reference the same chunk, the referenced segment has to be resolved only once
+    if (pos_list.references_single_chunk()) {
+      const auto& chunk = table->get_chunk(pos_list.common_chunk_id());
+      const auto base_segment = chunk.get_segment(segment.referenced_column_id());
+      const auto tmp_result = scan(chunk_id, base_segment, cmp_value, pos_list, 0, pos_list.size());
+      result.insert(result.end(), tmp_result.cbegin(), tmp_result.cend());
+      return result;
+    }
+
     size_t start_index = 0;
     auto last_chunk_id = pos_list[0].chunk_id;
 
@@ -173,7 +203,7 @@ class AbstractSegmentScanner : private Noncopyable {
       if (row_id.chunk_id != last_chunk_id) {
         const auto& chunk = table->get_chunk(last_chunk_id);
         const auto base_segment = chunk.get_segment(segment.referenced_column_id());
-        const auto tmp_result = scan(last_chunk_id, base_segment, cmp_value, pos_list, start_index, index);
+        const auto tmp_result = scan(chunk_id, base_segment, cmp_value, pos_list, start_index, index);
         // Move elements from tmp_result to the end of result
         result.insert(result.end(), std::make_move_iterator(tmp_result.begin()),
                       std::make_move_iterator(tmp_result.end()));
@@ -186,7 +216,7 @@ class AbstractSegmentScanner : private Noncopyable {
     {
       const auto& chunk = table->get_chunk(last_chunk_id);
       const auto base_segment = chunk.get_segment(segment.referenced_column_id());
-      const auto tmp_result = scan(last_chunk_id, base_segment, cmp_value, pos_list, start_index, pos_list.size());
+      const auto tmp_result = scan(chunk_id, base_segment, cmp_value, pos_list, start_index, pos_list.size());
       // Move elements from tmp_result to the end of result
       result.insert(result.end(), std::make_move_iterator(tmp_result.begin()),
                     std::make_move_iterator(tmp_result.end()));
@@ -227,7 +257,7 @@ class AbstractSegmentScanner : private Noncopyable {
 
   /**
    * Scans a BaseSegment
-   * @param chunk_id ChunkId to segment which is scanned.
+   * @param chunk_id ChunkId written to the selected RowIDs, whose offsets are the indices within pos_list.
    * @param segment Segment to be scanned
    * @param cmp_value Value to comparte values to
    * @param pos_list List of positions to evaluate
@@ -267,7 +297,7 @@ class AbstractSegmentScanner : private Noncopyable {
       const auto index = index_fetcher.next();
       const auto& value_id = attribute_vector->get(index);
       if (compare_by_value_id(value_id, value_id_to_compare_to)) {
-        pos_list.emplace_back(RowID{chunk_id, ChunkOffset(index)});
+        pos_list.emplace_back(RowID{chunk_id, ChunkOffset(index_fetcher.position())});
       }
     }
 
@@ -289,7 +319,7 @@ class AbstractSegmentScanner : private Noncopyable {
       const auto index = index_fetcher.next();
       const T& value = values[index];
       if (compare(value, cmp_value)) {
-        pos_list.emplace_back(RowID{chunk_id, ChunkOffset(index)});
+        pos_list.emplace_back(RowID{chunk_id, ChunkOffset(index_fetcher.position())});
       }
     }
 
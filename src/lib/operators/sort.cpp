@@ -0,0 +1,355 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Below this number of rows, the rows are sorted by a single thread
+constexpr auto MIN_ROWS_FOR_PARALLEL_SORT = size_t{10'000};
+
+// Merges the neighboring sorted runs [run_bounds[i], run_bounds[i + 1]) of elements pairwise, in parallel, until all
+// elements are sorted
+template <typename Element>
+void merge_sorted_runs(std::vector<Element>& elements, std::vector<size_t> run_bounds) {
+  while (run_bounds.size() > 2) {
+    const auto run_count = run_bounds.size() - 1;
+    auto next_run_bounds = std::vector<size_t>{0};
+    auto jobs = std::vector<std::function<void()>>{};
+
+    for (auto run_index = size_t{0}; run_index < run_count; run_index += 2) {
+      if (run_index + 1 == run_count) {
+        next_run_bounds.emplace_back(run_bounds[run_index + 1]);
+        continue;
+      }
+
+      const auto begin = elements.begin() + run_bounds[run_index];
+      const auto middle = elements.begin() + run_bounds[run_index + 1];
+      const auto end = elements.begin() + run_bounds[run_index + 2];
+      jobs.emplace_back([begin, middle, end]() { std::inplace_merge(begin, middle, end); });
+      next_run_bounds.emplace_back(run_bounds[run_index + 2]);
+    }
+
+    execute_in_parallel(jobs);
+    run_bounds = std::move(next_run_bounds);
+  }
+}
+
+// Sorts elements by splitting them into runs that are sorted in parallel and merged afterwards
+template <typename Element>
+void parallel_sort(std::vector<Element>& elements) {
+  const auto run_count = elements.size() >= MIN_ROWS_FOR_PARALLEL_SORT
+                             ? size_t{2} * std::max(std::thread::hardware_concurrency(), 1u)
+                             : size_t{1};
+
+  auto run_bounds = std::vector<size_t>(run_count + 1);
+  for (auto run_index = size_t{0}; run_index <= run_count; ++run_index) {
+    run_bounds[run_index] = elements.size() * run_index / run_count;
+  }
+
+  auto jobs = std::vector<std::function<void()>>{};
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    const auto begin = elements.begin() + run_bounds[run_index];
+    const auto end = elements.begin() + run_bounds[run_index + 1];
+    jobs.emplace_back([begin, end]() { std::sort(begin, end); });
+  }
+  execute_in_parallel(jobs);
+
+  merge_sorted_runs(elements, std::move(run_bounds));
+}
+
+// Encodes a number as an unsigned integer of the same width whose order matches the order of the numbers
+template <typename T>
+uint64_t normalize_value(const T& value) {
+  constexpr auto SIGN_BIT = uint64_t{1} << (sizeof(T) * 8 - 1);
+
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<std::make_unsigned_t<T>>(value) ^ SIGN_BIT;
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+    // 0.0 and -0.0 are equal, but have different bit patterns
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Bits{0};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+
+    // Negative numbers are stored as sign and magnitude, so their order has to be inverted
+    return bits & SIGN_BIT ? static_cast<Bits>(~bits) : bits | SIGN_BIT;
+  }
+}
+
+// Ors the lowest bit_width bits of code into words, starting bit_offset bits after the most significant bit of words[0]
+void write_bits(uint64_t* words, const size_t bit_offset, const size_t bit_width, const uint64_t code) {
+  const auto word_index = bit_offset / 64;
+  const auto available_bits = 64 - bit_offset % 64;
+
+  if (bit_width <= available_bits) {
+    words[word_index] |= code << (available_bits - bit_width);
+  } else {
+    const auto overflowing_bits = bit_width - available_bits;
+    words[word_index] |= code >> overflowing_bits;
+    words[word_index + 1] |= code << (64 - overflowing_bits);
+  }
+}
+
+/**
+ * A row to be sorted. Key is either std::array<uint64_t, n> or, for very wide keys, std::vector<uint64_t>. Both compare
+ * lexicographically. row is the RowID of the input row as chunk_id << 32 | chunk_offset. Comparing it for equal keys
+ * makes std::sort keep the input order of equal rows.
+ */
+template <typename Key>
+struct SortRecord {
+  Key key;
+  uint64_t row;
+
+  bool operator<(const SortRecord& other) const { return std::tie(key, row) < std::tie(other.key, other.row); }
+};
+
+// A sort column and the position of its normalized values within the normalized keys
+struct KeyColumn {
+  ColumnID column_id;
+  bool descending;
+  size_t bit_offset;
+  size_t bit_width;
+
+  // Only used for strings: the distinct strings of the column in sorted order. Strings are encoded as their index.
+  std::vector<std::string> sorted_strings;
+};
+
+class SortImpl {
+ public:
+  SortImpl(const std::shared_ptr<const Table>& input_table,
+           const std::vector<SortColumnDefinition>& sort_column_definitions)
+      : _input_table(input_table), _sort_column_definitions(sort_column_definitions) {}
+
+  std::shared_ptr<Table> execute() {
+    _create_key_columns();
+
+    auto pos_list = std::shared_ptr<PosList>{};
+    const auto word_count = (_key_bit_count + 63) / 64;
+    switch (word_count) {
+      case 1:
+        pos_list = _sort<std::array<uint64_t, 1>>();
+        break;
+      case 2:
+        pos_list = _sort<std::array<uint64_t, 2>>();
+        break;
+      case 3:
+        pos_list = _sort<std::array<uint64_t, 3>>();
+        break;
+      case 4:
+        pos_list = _sort<std::array<uint64_t, 4>>();
+        break;
+      default:
+        pos_list = _sort<std::vector<uint64_t>>();
+    }
+
+    auto output_table = std::make_shared<Table>();
+    for (ColumnID column_id{0}; column_id < _input_table->column_count(); ++column_id) {
+      output_table->add_column_definition(_input_table->column_name(column_id), _input_table->column_type(column_id));
+    }
+
+    Chunk chunk;
+    write_output_segments(chunk, _input_table, pos_list);
+    output_table->emplace_chunk(std::move(chunk));
+    return output_table;
+  }
+
+ protected:
+  void _create_key_columns() {
+    for (const auto& definition : _sort_column_definitions) {
+      const auto column_id = definition.column_id;
+      Assert(column_id < _input_table->column_count(), "Sort column does not exist.");
+
+      auto key_column = KeyColumn{column_id, definition.order_by_mode == OrderByMode::Descending, _key_bit_count, 0,
+                                  std::vector<std::string>{}};
+      resolve_data_type(_input_table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          key_column.sorted_strings = _sorted_distinct_strings(column_id);
+          key_column.bit_width = 1;
+          while ((uint64_t{1} << key_column.bit_width) < key_column.sorted_strings.size()) {
+            ++key_column.bit_width;
+          }
+        } else {
+          key_column.bit_width = sizeof(ColumnDataType) * 8;
+        }
+      });
+
+      _key_bit_count += key_column.bit_width;
+      _key_columns.emplace_back(std::move(key_column));
+    }
+  }
+
+  // Collects the distinct strings of each chunk in parallel and merges them
+  std::vector<std::string> _sorted_distinct_strings(const ColumnID column_id) const {
+    const auto chunk_count = _input_table->chunk_count();
+    auto chunk_strings = std::vector<std::vector<std::string>>(chunk_count);
+
+    auto jobs = std::vector<std::function<void()>>{};
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        const auto segment = _input_table->get_chunk(chunk_id).get_segment(column_id);
+        auto& strings = chunk_strings[chunk_id];
+
+        // Dictionaries are already sorted and distinct
+        if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<std::string>>(segment)) {
+          strings = *dictionary_segment->dictionary();
+          return;
+        }
+
+        segment_iterate<std::string>(*segment, [&](const auto& position) { strings.emplace_back(position.value()); });
+        std::sort(strings.begin(), strings.end());
+        strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+      });
+    }
+    execute_in_parallel(jobs);
+
+    auto sorted_strings = std::vector<std::string>{};
+    auto run_bounds = std::vector<size_t>{0};
+    for (auto& strings : chunk_strings) {
+      std::move(strings.begin(), strings.end(), std::back_inserter(sorted_strings));
+      run_bounds.emplace_back(sorted_strings.size());
+    }
+    merge_sorted_runs(sorted_strings, std::move(run_bounds));
+    sorted_strings.erase(std::unique(sorted_strings.begin(), sorted_strings.end()), sorted_strings.end());
+    return sorted_strings;
+  }
+
+  template <typename Key>
+  std::shared_ptr<PosList> _sort() const {
+    const auto chunk_count = _input_table->chunk_count();
+    auto chunk_begins = std::vector<size_t>(chunk_count + 1, 0);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunk_begins[chunk_id + 1] = chunk_begins[chunk_id] + _input_table->get_chunk(chunk_id).size();
+    }
+
+    // Create the normalized keys of each chunk in parallel
+    auto records = std::vector<SortRecord<Key>>(chunk_begins.back());
+    auto jobs = std::vector<std::function<void()>>{};
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        auto* chunk_records = records.data() + chunk_begins[chunk_id];
+        const auto chunk_size = chunk_begins[chunk_id + 1] - chunk_begins[chunk_id];
+        for (auto chunk_offset = size_t{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          if constexpr (std::is_same_v<Key, std::vector<uint64_t>>) {
+            chunk_records[chunk_offset].key.resize((_key_bit_count + 63) / 64);
+          }
+          chunk_records[chunk_offset].row = uint64_t{chunk_id} << 32 | chunk_offset;
+        }
+
+        const auto& chunk = _input_table->get_chunk(chunk_id);
+        for (const auto& key_column : _key_columns) {
+          _write_key_column(*chunk.get_segment(key_column.column_id), key_column, chunk_records);
+        }
+      });
+    }
+    execute_in_parallel(jobs);
+
+    parallel_sort(records);
+
+    auto pos_list = std::make_shared<PosList>(records.size());
+    for (auto index = size_t{0}; index < records.size(); ++index) {
+      const auto row = records[index].row;
+      (*pos_list)[index] = RowID{ChunkID{static_cast<ChunkID::base_type>(row >> 32)}, static_cast<ChunkOffset>(row)};
+    }
+    if (chunk_count == 1) pos_list->guarantee_single_chunk();
+    return pos_list;
+  }
+
+  // Writes the normalized values of segment to the keys of the records of its chunk
+  template <typename Record>
+  void _write_key_column(const BaseSegment& segment, const KeyColumn& key_column, Record* records) const {
+    const auto mask = key_column.bit_width == 64 ? ~uint64_t{0} : (uint64_t{1} << key_column.bit_width) - 1;
+    const auto write = [&](const uint64_t code, const ChunkOffset chunk_offset) {
+      const auto normalized_code = key_column.descending ? ~code & mask : code;
+      write_bits(records[chunk_offset].key.data(), key_column.bit_offset, key_column.bit_width, normalized_code);
+    };
+
+    resolve_data_type(_input_table->column_type(key_column.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        const auto& sorted_strings = key_column.sorted_strings;
+
+        // The dictionary is sorted, too, so the ranks of all its strings can be found by a single merge-like pass
+        if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<std::string>*>(&segment)) {
+          const auto& dictionary = *dictionary_segment->dictionary();
+          auto ranks = std::vector<uint64_t>(dictionary.size());
+          auto rank = uint64_t{0};
+          for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+            while (sorted_strings[rank] < dictionary[value_id]) ++rank;
+            ranks[value_id] = rank;
+          }
+
+          resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+              write(ranks[value_ids[chunk_offset]], chunk_offset);
+            }
+          });
+          return;
+        }
+
+        segment_iterate<std::string>(segment, [&](const auto& position) {
+          const auto rank = std::lower_bound(sorted_strings.cbegin(), sorted_strings.cend(), position.value());
+          write(std::distance(sorted_strings.cbegin(), rank), position.chunk_offset());
+        });
+      } else {
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          write(normalize_value(position.value()), position.chunk_offset());
+        });
+      }
+    });
+  }
+
+  const std::shared_ptr<const Table> _input_table;
+  const std::vector<SortColumnDefinition>& _sort_column_definitions;
+
+  std::vector<KeyColumn> _key_columns;
+  size_t _key_bit_count{0};
+};
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in,
+           const std::vector<SortColumnDefinition>& sort_column_definitions)
+    : AbstractOperator(in), _sort_column_definitions(sort_column_definitions) {
+  Assert(in != nullptr, "Input operator must be defined.");
+  Assert(!sort_column_definitions.empty(), "Sort requires at least one sort column.");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_column_definitions() const { return _sort_column_definitions; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  return SortImpl{input_table, _sort_column_definitions}.execute();
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class OrderByMode { Ascending, Descending };
+
+struct SortColumnDefinition {
+  explicit SortColumnDefinition(const ColumnID column_id, const OrderByMode order_by_mode = OrderByMode::Ascending)
+      : column_id(column_id), order_by_mode(order_by_mode) {}
+
+  ColumnID column_id;
+  OrderByMode order_by_mode;
+};
+
+/**
+ * Sorts the input rows by one or more columns. The first definition is the most significant one. Rows that are equal
+ * in all sort columns keep their input order, i.e., the sort is stable. The output consists of a single chunk of
+ * ReferenceSegments whose position list lists the input rows in sorted order.
+ *
+ * Instead of comparing values of different types column by column, every row is converted into a normalized key: the
+ * values of the sort columns are encoded as unsigned integers whose order matches the order of the values, inverted
+ * for descending columns, and concatenated into a fixed number of 64 bit words. Comparing two rows then only requires
+ * comparing these words. Strings are encoded as their rank among all distinct strings of the column, which is computed
+ * once up front (using the sorted dictionaries of DictionarySegments).
+ *
+ * The keys are created chunk by chunk in parallel. They are sorted with a parallel merge sort: runs are sorted in
+ * parallel and then merged pairwise, again in parallel.
+ */
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in,
+       const std::vector<SortColumnDefinition>& sort_column_definitions);
+
+  const std::vector<SortColumnDefinition>& sort_column_definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_column_definitions;
+};
+
+}  // namespace opossum
@@ -1,18 +1,22 @@
 #include "table_scan.hpp"
 
+#include <chrono>
 #include <memory>
 
 #include "base_table_scan_impl.hpp"
+#include "output_segments.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table.hpp"
 #include "table_scan_impl.hpp"
+#include "tuning/index_advisor.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value)
-    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {
+    : AbstractStreamingOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {
   Assert(in != nullptr, "Input operator must be defined.");
 }
 
@@ -22,14 +26,48 @@ ScanType TableScan::scan_type() const { return _scan_type; }
 
 AllTypeVariant TableScan::search_value() const { return _search_value; }
 
+std::shared_ptr<Table> TableScan::prepare_streaming(const std::shared_ptr<const Table>& input_table) {
+  // Fails early if the search value does not match the column
+  opossum::make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(input_table->column_type(column_id()),
+                                                                       input_table, column_id(), scan_type(),
+                                                                       search_value());
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  return output_table;
+}
+
+Chunk TableScan::process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const {
+  const auto table_scan = opossum::make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+      input_table->column_type(column_id()), input_table, column_id(), scan_type(), search_value());
+
+  Chunk chunk;
+  write_output_segments(chunk, input_table, table_scan->scan_chunk(chunk_id));
+  return chunk;
+}
+
 std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto& input_table = _input_table_left();
   Assert(input_table != nullptr, "Input table must be defined.");
 
+  const auto begin = std::chrono::steady_clock::now();
+
   const auto& data_type = input_table->column_type(column_id());
   auto table_scan = opossum::make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
       data_type, input_table, column_id(), scan_type(), search_value());
-  return table_scan->execute();
+  const auto output_table = table_scan->execute();
+
+  // Let the IndexAdvisor know about the predicate, so that it can index the column if the predicate is selective
+  const auto runtime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+  const auto input_row_count = input_table->row_count();
+  const auto selectivity = input_row_count == 0 ? 0.0
+                                                : static_cast<double>(output_table->row_count()) /
+                                                      static_cast<double>(input_row_count);
+  IndexAdvisor::get().record_predicate(*input_table, column_id(), input_row_count, selectivity, runtime);
+
+  return output_table;
 }
 
 }  // namespace opossum
@@ -2,7 +2,7 @@
 
 #include <memory>
 
-#include "abstract_operator.hpp"
+#include "abstract_streaming_operator.hpp"
 #include "all_type_variant.hpp"
 #include "types.hpp"
 
@@ -10,8 +10,21 @@ namespace opossum {
 
 class Table;
 
-class TableScan : public AbstractOperator {
+/**
+ * Selects the rows whose value in column_id compares to search_value according to scan_type. The output contains one
+ * chunk of ReferenceSegments per input chunk with matching rows.
+ *
+ * Chunks are scanned sequentially, unless they have an index whose first indexed segment is the scanned one (see
+ * IndexScan) and the predicate is selective: if the index lists at most INDEX_SCAN_MAX_SELECTIVITY of the chunk's rows
+ * as matching, they are read from the index instead. Counting the matches in the index stops at this limit, so that
+ * the decision costs at most as much as the index scan. Chunks with and without index can be mixed freely.
+ *
+ * In a pipeline, each chunk is scanned as it arrives. The table hash index is not used there, as it covers all chunks.
+ */
+class TableScan : public AbstractStreamingOperator {
  public:
+  static constexpr auto INDEX_SCAN_MAX_SELECTIVITY = 0.01;
+
   explicit TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value);
 
@@ -19,6 +32,9 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   AllTypeVariant search_value() const;
 
+  std::shared_ptr<Table> prepare_streaming(const std::shared_ptr<const Table>& input_table) override;
+  Chunk process_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const override;
+
  protected:
   const ColumnID _column_id;
   const ScanType _scan_type;
@@ -1,21 +1,30 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "base_table_scan_impl.hpp"
+#include "index_scan.hpp"
+#include "output_segments.hpp"
 #include "resolve_type.hpp"
 #include "segment_scanner.hpp"
+#include "table_scan.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 
 #include "boost/variant/get.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
 
 namespace opossum {
 
@@ -66,48 +75,109 @@ class TableScanImpl : public BaseTableScanImpl {
                                           _input_table->column_type(column_index));
     }
 
-    const auto scanner = AbstractSegmentScanner<T>::from_scan_type(_scan_type);
-
-    // Iterate over all chunks of the input table.
-    // Each chunk is scanned individually.
-    // Rows within chunk, for which the filter criterion applies, will be selected and added to a ReferenceSegment
-    // This ReferenceSegment will be added to a new chunk within the output_table
-    for (ChunkID chunk_id{0}; chunk_id < _input_table->chunk_count(); ++chunk_id) {
-      const auto segment_to_scan = _input_table->get_chunk(chunk_id).get_segment(_column_id);
-      const auto pos_list = std::make_shared<const PosList>(scanner->scan(chunk_id, segment_to_scan, _search_value));
-
-      // Don't add e,pty chunks
-      if (!pos_list->empty()) {
-        Chunk chunk_to_add;
-        if (const auto& ref_seg = std::dynamic_pointer_cast<ReferenceSegment>(segment_to_scan)) {
-          chunk_to_add = _create_chunk(pos_list, ref_seg->referenced_table());
-        } else {
-          chunk_to_add = _create_chunk(pos_list, _input_table);
-        }
-
-        output_table->emplace_chunk(std::move(chunk_to_add));
+    // Equality predicates on a column with a table hash index are answered with a single lookup
+    if (_scan_type == ScanType::OpEquals) {
+      if (const auto hash_index = _input_table->get_hash_index(_column_id)) {
+        _write_hash_index_matches(*output_table, *hash_index);
+        return output_table;
       }
     }
 
+    // Each chunk is scanned individually by a job that runs on the node of the chunk. Rows within a chunk, for which
+    // the filter criterion applies, are selected and added to a ReferenceSegment. This ReferenceSegment is added to a
+    // new chunk within the output_table, which is assigned to the same node.
+    const auto chunk_count = _input_table->chunk_count();
+    auto pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+    auto jobs = std::vector<std::function<void()>>{};
+    auto node_ids = std::vector<NodeID>{};
+    jobs.reserve(chunk_count);
+    node_ids.reserve(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() { pos_lists[chunk_id] = scan_chunk(chunk_id); });
+      node_ids.emplace_back(_input_table->get_chunk(chunk_id).node_id());
+    }
+    execute_in_parallel(jobs, node_ids);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      // Don't add empty chunks
+      if (pos_lists[chunk_id]->empty()) continue;
+
+      // The positions refer to _input_table. If it consists of ReferenceSegments, they are resolved so that the
+      // output references the tables that store the data.
+      Chunk chunk_to_add;
+      write_output_segments(chunk_to_add, _input_table, pos_lists[chunk_id]);
+      chunk_to_add.set_node_id(node_ids[chunk_id]);
+      output_table->emplace_chunk(std::move(chunk_to_add));
+    }
+
     // In case no rows were selected, create one empty chunk within the output_table.
     if (output_table->row_count() == 0) {
-      output_table->emplace_chunk(std::move(_create_chunk(std::make_shared<PosList>(), _input_table)));
+      Chunk empty_chunk;
+      write_output_segments(empty_chunk, _input_table, std::make_shared<PosList>());
+      output_table->emplace_chunk(std::move(empty_chunk));
     }
 
     return output_table;
   }
 
+  std::shared_ptr<const PosList> scan_chunk(const ChunkID chunk_id) const override {
+    const auto& chunk = _input_table->get_chunk(chunk_id);
+    auto index_pos_list = _scan_with_index(chunk_id, chunk);
+    if (index_pos_list) return std::make_shared<const PosList>(std::move(*index_pos_list));
+
+    const auto scanner = AbstractSegmentScanner<T>::from_scan_type(_scan_type);
+    return std::make_shared<const PosList>(scanner->scan(chunk_id, chunk.get_segment(_column_id), _search_value));
+  }
+
+  /**
+   * Adds one chunk per input chunk with rows that the hash index lists for the search value to output_table. Each
+   * output chunk is assigned to the node of its input chunk.
+   */
+  void _write_hash_index_matches(Table& output_table, const BaseTableHashIndex& hash_index) const {
+    auto matches = hash_index.lookup(AllTypeVariant{_search_value});
+    std::sort(matches.begin(), matches.end());
+
+    for (auto begin = matches.cbegin(); begin != matches.cend();) {
+      const auto chunk_id = begin->chunk_id;
+      const auto end =
+          std::find_if(begin, matches.cend(), [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+      auto pos_list = std::make_shared<PosList>(begin, end);
+      pos_list->guarantee_single_chunk();
+      pos_list->guarantee_sorted();
+
+      Chunk chunk_to_add;
+      write_output_segments(chunk_to_add, _input_table, pos_list);
+      chunk_to_add.set_node_id(_input_table->get_chunk(chunk_id).node_id());
+      output_table.emplace_chunk(std::move(chunk_to_add));
+      begin = end;
+    }
+
+    if (output_table.row_count() == 0) {
+      Chunk empty_chunk;
+      write_output_segments(empty_chunk, _input_table, std::make_shared<PosList>());
+      output_table.emplace_chunk(std::move(empty_chunk));
+    }
+  }
+
   /**
-   * Creates a new chunk.
-   * The new chunk will have a ReferenceSegement initialized with pos_list for each segment in table.
+   * Returns the selected rows of a chunk that has an index on the scanned column if they are at most
+   * INDEX_SCAN_MAX_SELECTIVITY of its rows, and nullopt otherwise.
    */
-  Chunk _create_chunk(const std::shared_ptr<const PosList>& pos_list, const std::shared_ptr<const Table>& table) const {
-    DebugAssert(table != nullptr, "Input table is not initialized.");
-    Chunk chunk;
-    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-      chunk.add_segment(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  std::optional<PosList> _scan_with_index(const ChunkID chunk_id, const Chunk& chunk) const {
+    const auto index = IndexScan::find_index(chunk, {_column_id});
+    if (!index) return std::nullopt;
+
+    const auto ranges = IndexScan::matching_ranges(*index, _scan_type, {AllTypeVariant{_search_value}});
+    const auto max_match_count = static_cast<size_t>(chunk.size() * TableScan::INDEX_SCAN_MAX_SELECTIVITY);
+    auto match_count = size_t{0};
+    for (const auto& range : ranges) {
+      for (auto it = range.first; it != range.second; ++it) {
+        if (++match_count > max_match_count) return std::nullopt;
+      }
     }
-    return chunk;
+
+    return IndexScan::positions(chunk_id, ranges);
   }
 };
 
@@ -0,0 +1,177 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+class TopKImpl {
+ public:
+  using Candidate = std::pair<T, RowID>;
+
+  TopKImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id, const bool descending,
+           const uint64_t row_count)
+      : _input_table(input_table), _column_id(column_id), _descending(descending), _row_count(row_count) {}
+
+  std::shared_ptr<PosList> execute() const {
+    auto pos_list = std::make_shared<PosList>();
+    const auto chunk_count = _input_table->chunk_count();
+    if (_row_count == 0 || chunk_count == 0) return pos_list;
+
+    // Each worker processes every worker_count-th chunk, in ascending order
+    const auto worker_count =
+        std::min(static_cast<size_t>(chunk_count), size_t{2} * std::max(std::thread::hardware_concurrency(), 1u));
+    auto heaps = std::vector<std::vector<Candidate>>(worker_count);
+    auto jobs = std::vector<std::function<void()>>{};
+    for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+      jobs.emplace_back([&, worker_id]() {
+        for (auto chunk_index = worker_id; chunk_index < size_t{chunk_count}; chunk_index += worker_count) {
+          _process_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_index)}, heaps[worker_id]);
+        }
+      });
+    }
+    execute_in_parallel(jobs);
+
+    auto candidates = std::move(heaps.front());
+    for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+      std::move(heaps[worker_id].begin(), heaps[worker_id].end(), std::back_inserter(candidates));
+    }
+    const auto is_better = [&](const Candidate& lhs, const Candidate& rhs) {
+      return _is_better(lhs.first, lhs.second, rhs);
+    };
+    const auto output_row_count = std::min(static_cast<size_t>(_row_count), candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + output_row_count, candidates.end(), is_better);
+
+    pos_list->reserve(output_row_count);
+    for (auto index = size_t{0}; index < output_row_count; ++index) {
+      pos_list->emplace_back(candidates[index].second);
+    }
+    if (chunk_count == 1) pos_list->guarantee_single_chunk();
+    return pos_list;
+  }
+
+ protected:
+  // returns true if the row (value, row_id) comes before other in the output
+  bool _is_better(const T& value, const RowID& row_id, const Candidate& other) const {
+    if (value < other.first) return !_descending;
+    if (other.first < value) return _descending;
+    return row_id < other.second;
+  }
+
+  // Adds the row to the heap if it is one of the best _row_count rows seen so far. The heap is ordered so that its
+  // front is the worst row.
+  void _offer(std::vector<Candidate>& heap, const T& value, const RowID& row_id) const {
+    const auto is_better = [&](const Candidate& lhs, const Candidate& rhs) {
+      return _is_better(lhs.first, lhs.second, rhs);
+    };
+
+    if (heap.size() < _row_count) {
+      heap.emplace_back(value, row_id);
+      std::push_heap(heap.begin(), heap.end(), is_better);
+    } else if (_is_better(value, row_id, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), is_better);
+      heap.back() = Candidate{value, row_id};
+      std::push_heap(heap.begin(), heap.end(), is_better);
+    }
+  }
+
+  void _process_chunk(const ChunkID chunk_id, std::vector<Candidate>& heap) const {
+    const auto segment = _input_table->get_chunk(chunk_id).get_segment(_column_id);
+
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment);
+    if (dictionary_segment && heap.size() == _row_count) {
+      // The rows of the heap come from earlier chunks, so they win all ties against the rows of this chunk. Thus, the
+      // chunk can only contribute rows whose values are strictly better than the worst value of the heap.
+      const auto& dictionary = *dictionary_segment->dictionary();
+      const auto& worst_value = heap.front().first;
+      const auto& best_chunk_value = _descending ? dictionary.back() : dictionary.front();
+      if (_descending ? !(worst_value < best_chunk_value) : !(best_chunk_value < worst_value)) return;
+
+      // As the dictionary is sorted, the candidates of the chunk form a range of value ids
+      auto begin_value_id = size_t{0};
+      auto end_value_id = dictionary.size();
+      if (_descending) {
+        begin_value_id = dictionary_segment->upper_bound(worst_value);
+      } else {
+        const auto lower_bound = dictionary_segment->lower_bound(worst_value);
+        if (lower_bound != INVALID_VALUE_ID) end_value_id = lower_bound;
+      }
+
+      resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+          const auto value_id = size_t{value_ids[chunk_offset]};
+          if (value_id < begin_value_id || value_id >= end_value_id) continue;
+          _offer(heap, dictionary[value_id], RowID{chunk_id, chunk_offset});
+        }
+      });
+      return;
+    }
+
+    segment_iterate<T>(*segment, [&](const auto& position) {
+      _offer(heap, position.value(), RowID{chunk_id, position.chunk_offset()});
+    });
+  }
+
+  const std::shared_ptr<const Table> _input_table;
+  const ColumnID _column_id;
+  const bool _descending;
+  const uint64_t _row_count;
+};
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_column_definition,
+           const uint64_t row_count)
+    : AbstractOperator(in), _sort_column_definition(sort_column_definition), _row_count(row_count) {
+  Assert(in != nullptr, "Input operator must be defined.");
+}
+
+const SortColumnDefinition& TopK::sort_column_definition() const { return _sort_column_definition; }
+
+uint64_t TopK::row_count() const { return _row_count; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table != nullptr, "Input table must be defined.");
+
+  const auto sort_column_id = _sort_column_definition.column_id;
+  Assert(sort_column_id < input_table->column_count(), "Sort column does not exist.");
+
+  auto pos_list = std::shared_ptr<PosList>{};
+  resolve_data_type(input_table->column_type(sort_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto descending = _sort_column_definition.order_by_mode == OrderByMode::Descending;
+    pos_list = TopKImpl<ColumnDataType>{input_table, sort_column_id, descending, _row_count}.execute();
+  });
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  Chunk chunk;
+  write_output_segments(chunk, input_table, pos_list);
+  output_table->emplace_chunk(std::move(chunk));
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Returns the row_count rows with the smallest (OrderByMode::Ascending) or largest (OrderByMode::Descending) values in
+ * one column, in that order. Among equal values, rows that come first in the input come first, so the output equals
+ * the first row_count rows of a Sort, without sorting the whole input. The output references the input rows in a
+ * single chunk.
+ *
+ * The chunks are distributed among workers that run in parallel, and each worker keeps its best row_count rows in a
+ * bounded heap. Before a worker scans a DictionarySegment, it compares the first or last dictionary entry, i.e., the
+ * best value of the chunk, with the worst row of its full heap and skips the whole chunk if it cannot contribute.
+ * Otherwise, only rows whose value ids are within the bound set by the heap are looked at. Finally, the heaps of all
+ * workers are merged.
+ */
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_column_definition,
+       const uint64_t row_count);
+
+  const SortColumnDefinition& sort_column_definition() const;
+  uint64_t row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const SortColumnDefinition _sort_column_definition;
+  const uint64_t _row_count;
+};
+
+}  // namespace opossum
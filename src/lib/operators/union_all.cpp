@@ -0,0 +1,55 @@
+#include "union_all.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
+                   const std::shared_ptr<const AbstractOperator> right_in)
+    : AbstractOperator(left_in, right_in) {
+  Assert(left_in != nullptr && right_in != nullptr, "Input operators must be defined.");
+}
+
+std::shared_ptr<const Table> UnionAll::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(left_table != nullptr && right_table != nullptr, "Input tables must be defined.");
+  Assert(left_table->column_names() == right_table->column_names() &&
+             left_table->column_types() == right_table->column_types(),
+         "Inputs of UnionAll must have the same column names and types.");
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  const auto forward_chunk = [&](const Chunk& input_chunk) {
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < input_chunk.column_count(); ++column_id) {
+      chunk.add_segment(input_chunk.get_segment(column_id));
+    }
+    output_table->emplace_chunk(std::move(chunk));
+  };
+
+  for (const auto& table : {left_table, right_table}) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      // Don't add empty chunks
+      if (chunk.size() > 0) forward_chunk(chunk);
+    }
+  }
+
+  // In case both inputs are empty, forward the (empty) first chunk of the left input
+  if (output_table->row_count() == 0) {
+    forward_chunk(left_table->get_chunk(ChunkID{0}));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
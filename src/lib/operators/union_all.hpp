@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Concatenates the rows of two inputs with the same column names and types, e.g., the partitions of a table or the
+ * results of two scans whose row sets are known to be disjoint. The chunks of the left input are followed by those
+ * of the right input. Their segments are forwarded without copying. Duplicates are kept, use UnionPositions to
+ * remove them.
+ */
+class UnionAll : public AbstractOperator {
+ public:
+  UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
+           const std::shared_ptr<const AbstractOperator> right_in);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
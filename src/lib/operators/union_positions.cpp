@@ -0,0 +1,149 @@
+#include "union_positions.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/execute_in_parallel.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A bitmap is used if the positions of a chunk make up at least 1/BITMAP_DENSITY of its rows. Scanning the bitmap
+// then costs less than sorting the positions.
+constexpr auto BITMAP_DENSITY = size_t{32};
+
+// sorts the positions, which all reference the same chunk of chunk_size rows, and removes duplicates
+void deduplicate(PosList& positions, const ChunkOffset chunk_size) {
+  if (positions.size() * BITMAP_DENSITY < chunk_size) {
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    return;
+  }
+
+  const auto chunk_id = positions.front().chunk_id;
+  auto bitmap = std::vector<uint64_t>((chunk_size + 63) / 64);
+  for (const auto& row_id : positions) {
+    bitmap[row_id.chunk_offset / 64] |= uint64_t{1} << (row_id.chunk_offset % 64);
+  }
+
+  positions.clear();
+  for (auto word_index = size_t{0}; word_index < bitmap.size(); ++word_index) {
+    auto word = bitmap[word_index];
+    while (word) {
+      const auto bit = static_cast<ChunkOffset>(__builtin_ctzll(word));
+      positions.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(word_index * 64 + bit)});
+      word &= word - 1;
+    }
+  }
+}
+
+}  // namespace
+
+UnionPositions::UnionPositions(const std::shared_ptr<const AbstractOperator> left_in,
+                               const std::shared_ptr<const AbstractOperator> right_in)
+    : AbstractOperator(left_in, right_in) {
+  Assert(left_in != nullptr && right_in != nullptr, "Input operators must be defined.");
+}
+
+std::shared_ptr<const Table> UnionPositions::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(left_table != nullptr && right_table != nullptr, "Input tables must be defined.");
+  Assert(left_table->column_names() == right_table->column_names() &&
+             left_table->column_types() == right_table->column_types(),
+         "Inputs of UnionPositions must have the same column names and types.");
+
+  const auto column_count = left_table->column_count();
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  // Collect the positions of both inputs, grouped by the referenced chunk, and check that all chunks reference the
+  // same columns of the same table
+  auto referenced_table = std::shared_ptr<const Table>{};
+  auto referenced_column_ids = std::vector<ColumnID>{};
+  auto positions_by_chunk = std::vector<PosList>{};
+
+  for (const auto& table : {left_table, right_table}) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      auto segments = std::vector<std::shared_ptr<const ReferenceSegment>>{};
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id)));
+        Assert(segments.back(), "UnionPositions requires inputs that consist of ReferenceSegments.");
+      }
+
+      if (!referenced_table) {
+        referenced_table = segments.front()->referenced_table();
+        for (const auto& segment : segments) {
+          referenced_column_ids.emplace_back(segment->referenced_column_id());
+        }
+        positions_by_chunk.resize(referenced_table->chunk_count());
+      }
+
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        const auto& segment = *segments[column_id];
+        Assert(segment.referenced_table() == referenced_table &&
+                   segment.referenced_column_id() == referenced_column_ids[column_id],
+               "Inputs of UnionPositions must reference the same columns of the same table.");
+        Assert(segment.pos_list() == segments.front()->pos_list(),
+               "The segments of a chunk must share their position list.");
+      }
+
+      for (const auto& row_id : *segments.front()->pos_list()) {
+        positions_by_chunk[row_id.chunk_id].emplace_back(row_id);
+      }
+    }
+  }
+
+  // In case both inputs are empty, forward the (empty) first chunk of the left input
+  if (!referenced_table) {
+    const auto& input_chunk = left_table->get_chunk(ChunkID{0});
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < input_chunk.column_count(); ++column_id) {
+      chunk.add_segment(input_chunk.get_segment(column_id));
+    }
+    output_table->emplace_chunk(std::move(chunk));
+    return output_table;
+  }
+
+  auto jobs = std::vector<std::function<void()>>{};
+  for (ChunkID chunk_id{0}; chunk_id < positions_by_chunk.size(); ++chunk_id) {
+    if (positions_by_chunk[chunk_id].empty()) continue;
+    jobs.emplace_back([&, chunk_id]() {
+      deduplicate(positions_by_chunk[chunk_id], referenced_table->get_chunk(chunk_id).size());
+    });
+  }
+  execute_in_parallel(jobs);
+
+  for (auto& positions : positions_by_chunk) {
+    if (positions.empty()) continue;
+
+    auto pos_list = std::make_shared<PosList>(std::move(positions));
+    pos_list->guarantee_single_chunk();
+    pos_list->guarantee_sorted();
+
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      chunk.add_segment(
+          std::make_shared<ReferenceSegment>(referenced_table, referenced_column_ids[column_id], pos_list));
+    }
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
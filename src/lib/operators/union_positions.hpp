@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Computes the set union of the rows of two inputs that reference the same table, e.g., the results of two scans on
+ * that table. A disjunction such as a < 3 OR b = 'x' can thus be executed as two scans followed by a UnionPositions.
+ * Rows that are contained in both inputs (or several times in one input) are only output once.
+ *
+ * Both inputs must consist of ReferenceSegments that reference the same columns of the same table, and within a
+ * chunk, all segments must share their position list, which is the case for the outputs of our scans, sorts, etc.
+ * Rows are thus identified by the RowID they reference.
+ *
+ * The positions of both inputs are grouped by the referenced chunk and deduplicated per chunk. If the positions cover
+ * a large fraction of the chunk, a bitmap with one bit per row of the chunk is used. Otherwise, the positions are
+ * sorted and duplicates are removed. The output contains one chunk per referenced chunk, with the positions in
+ * ascending order.
+ */
+class UnionPositions : public AbstractOperator {
+ public:
+  UnionPositions(const std::shared_ptr<const AbstractOperator> left_in,
+                 const std::shared_ptr<const AbstractOperator> right_in);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#include "abstract_task.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<TaskID> next_task_id{0};
+
+}  // namespace
+
+AbstractTask::AbstractTask() : _id(next_task_id++) {}
+
+TaskID AbstractTask::id() const { return _id; }
+
+NodeID AbstractTask::node_id() const { return _node_id; }
+
+void AbstractTask::set_node_id(const NodeID node_id) {
+  Assert(!_is_scheduled, "Node cannot be changed after the task was scheduled.");
+  _node_id = node_id;
+}
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled && !successor->_is_scheduled, "Dependencies cannot be added to scheduled tasks.");
+  _successors.emplace_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+void AbstractTask::schedule() {
+  Assert(!_is_scheduled.exchange(true), "Task was already scheduled.");
+  _try_enqueue();
+}
+
+void AbstractTask::join() {
+  {
+    auto lock = std::unique_lock<std::mutex>{_done_mutex};
+    _done_condition.wait(lock, [&]() { return _is_done.load(); });
+  }
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task was executed before its predecessors were done.");
+  try {
+    _on_execute();
+  } catch (...) {
+    _exception = std::current_exception();
+  }
+
+  // Successors are made ready even if this task failed, so that whoever waits for them is not blocked forever
+  for (const auto& successor : _successors) {
+    --successor->_pending_predecessor_count;
+    successor->_try_enqueue();
+  }
+
+  {
+    std::lock_guard lock(_done_mutex);
+    _is_done = true;
+  }
+  _done_condition.notify_all();
+}
+
+void AbstractTask::_try_enqueue() {
+  if (!_is_scheduled || !is_ready() || _is_enqueued.exchange(true)) return;
+
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->enqueue(shared_from_this());
+  } else {
+    execute();
+  }
+}
+
+}  // namespace opossum
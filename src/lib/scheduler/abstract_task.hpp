@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A task is a unit of work that the Scheduler executes on one of its workers. Tasks can depend on other tasks: a task
+ * is only executed once all of its predecessors are done. This way, tasks form a directed acyclic graph, whose
+ * independent parts are executed concurrently.
+ *
+ * A task is executed exactly once, after it was scheduled (see schedule) and its predecessors are done. Whoever
+ * finishes the last of these two steps hands the task to the scheduler. If no scheduler is set (see CurrentScheduler),
+ * tasks are executed immediately by the thread that makes them ready.
+ *
+ * Exceptions thrown by a task are caught and rethrown by join, so that they reach the thread that waits for the task.
+ */
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  AbstractTask();
+  virtual ~AbstractTask() = default;
+
+  TaskID id() const;
+
+  // Returns the NUMA node whose workers should execute the task, e.g., because it works on a chunk assigned to that
+  // node, or ANY_NODE_ID. Must be set before the task is scheduled.
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+
+  // returns true if all predecessors are done
+  bool is_ready() const;
+
+  bool is_done() const;
+
+  // Makes this task a predecessor of successor, i.e., successor is executed after this task. Must be called before
+  // either of them is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // hands the task to the current scheduler, which executes it once it is ready
+  void schedule();
+
+  // Waits until the task is done and rethrows its exception, if any. Should not be called from a worker, which
+  // should use CurrentScheduler::wait_for_tasks instead, so that it keeps executing other tasks while waiting.
+  void join();
+
+  // executes the task and then makes its successors ready. Called by the scheduler.
+  void execute();
+
+ protected:
+  virtual void _on_execute() = 0;
+
+  // enqueues the task if it was scheduled and all of its predecessors are done, unless that already happened
+  void _try_enqueue();
+
+  const TaskID _id;
+  NodeID _node_id{ANY_NODE_ID};
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+  std::atomic<bool> _is_scheduled{false};
+  std::atomic<bool> _is_enqueued{false};
+
+  std::atomic<bool> _is_done{false};
+  std::exception_ptr _exception;
+  std::mutex _done_mutex;
+  std::condition_variable _done_condition;
+};
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "scheduler.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Scheduler> CurrentScheduler::_instance;
+
+const std::shared_ptr<Scheduler>& CurrentScheduler::get() { return _instance; }
+
+void CurrentScheduler::set(const std::shared_ptr<Scheduler>& scheduler) { _instance = scheduler; }
+
+bool CurrentScheduler::is_set() { return _instance != nullptr; }
+
+void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker) worker->wait_for_tasks(tasks);
+
+  // Does not block anymore if the worker waited already, but rethrows the exceptions in the order of the tasks
+  for (const auto& task : tasks) {
+    task->join();
+  }
+}
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+  wait_for_tasks(tasks);
+}
+
+}  // namespace opossum
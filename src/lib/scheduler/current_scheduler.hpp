@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class AbstractTask;
+class Scheduler;
+
+/**
+ * Holds the Scheduler that executes scheduled tasks. If none is set, tasks are executed as soon as they are scheduled
+ * and ready, by the thread that scheduled them or that finished their last predecessor.
+ */
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<Scheduler>& get();
+
+  // sets the scheduler (or none, if scheduler is nullptr), which should be finished before it is replaced
+  static void set(const std::shared_ptr<Scheduler>& scheduler);
+
+  static bool is_set();
+
+  // Waits until all tasks are done and rethrows the first exception thrown by any of them. On a worker thread, the
+  // worker executes other tasks while waiting.
+  static void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // schedules all tasks and waits for them (see wait_for_tasks)
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  static std::shared_ptr<Scheduler> _instance;
+};
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// A task that executes a function, e.g., the processing of one morsel of an operator
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(std::function<void()> function) : _function(std::move(function)) {}
+
+ protected:
+  void _on_execute() override { _function(); }
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Adds the tasks of op and of the operators below it to tasks, inputs first. Returns the task of op.
+std::shared_ptr<AbstractTask> add_tasks(const std::shared_ptr<AbstractOperator>& op,
+                                        std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractTask>>&
+                                            task_by_operator,
+                                        std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto existing_task = task_by_operator.find(op.get());
+  if (existing_task != task_by_operator.cend()) return existing_task->second;
+
+  const auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input) continue;
+
+    // Operators only hold their inputs as const, but the inputs still have to be executed
+    const auto input_task = add_tasks(std::const_pointer_cast<AbstractOperator>(input), task_by_operator, tasks);
+    input_task->set_as_predecessor_of(task);
+  }
+
+  task_by_operator.emplace(op.get(), task);
+  tasks.emplace_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator(op) {
+  Assert(_operator != nullptr, "Operator must be defined.");
+}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  auto task_by_operator = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractTask>>{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  add_tasks(op, task_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _operator; }
+
+void OperatorTask::_on_execute() { _operator->execute(); }
+
+}  // namespace opossum
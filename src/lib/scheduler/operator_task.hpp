@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// A task that executes an operator. Its inputs have to be executed by predecessors of the task.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  /**
+   * Creates a task for op and for every operator below it. Each task is a successor of the tasks of its operator's
+   * inputs, so that scheduling all of them executes the operator tree with independent subtrees (e.g., the inputs of
+   * a join) running concurrently. An operator that is the input of several operators gets a single task. The task of
+   * op is the last one.
+   */
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
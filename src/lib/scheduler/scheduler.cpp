@@ -0,0 +1,163 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+Scheduler::Scheduler(const size_t worker_count) {
+  Assert(worker_count > 0, "Scheduler needs at least one worker.");
+
+  const auto& topology = Topology::get();
+  auto cpus = std::vector<std::pair<NodeID, CpuID>>{};
+  for (auto node_id = NodeID{0}; node_id < topology.node_count(); ++node_id) {
+    for (const auto cpu_id : topology.nodes()[node_id].cpus) {
+      cpus.emplace_back(node_id, cpu_id);
+    }
+  }
+
+  _node_workers.resize(topology.node_count());
+  for (auto worker_id = WorkerID{0}; worker_id < worker_count; ++worker_id) {
+    const auto& cpu = cpus[worker_id % cpus.size()];
+    _queues.emplace_back(std::make_shared<TaskQueue>());
+    _workers.emplace_back(std::make_shared<Worker>(*this, worker_id, cpu.first, cpu.second, _queues.back()));
+    _node_workers[cpu.first].emplace_back(worker_id);
+  }
+
+  // Workers steal from the other workers of their node first, then from the workers of the following nodes
+  _steal_order.resize(worker_count);
+  for (const auto& worker : _workers) {
+    for (auto node_offset = size_t{0}; node_offset < _node_workers.size(); ++node_offset) {
+      const auto& node_workers = _node_workers[(worker->node_id() + node_offset) % _node_workers.size()];
+      for (const auto other_worker_id : node_workers) {
+        if (other_worker_id != worker->id()) _steal_order[worker->id()].emplace_back(other_worker_id);
+      }
+    }
+  }
+
+  // Pinning only pays off if there are several nodes. Fake nodes do not have the CPUs they list.
+  const auto pin = topology.node_count() > 1 && !topology.is_fake();
+  for (const auto& worker : _workers) {
+    worker->start(pin);
+  }
+}
+
+Scheduler::~Scheduler() {
+  if (!_is_shutting_down) finish();
+}
+
+void Scheduler::finish() {
+  Assert(!_is_shutting_down, "Scheduler was already finished.");
+  Assert(!Worker::get_this_thread_worker(), "Scheduler cannot be finished by one of its workers.");
+
+  {
+    auto lock = std::unique_lock<std::mutex>{_mutex};
+    _done_condition.wait(lock, [&]() { return _active_task_count == 0; });
+    _is_shutting_down = true;
+  }
+  _work_condition.notify_all();
+
+  for (const auto& worker : _workers) {
+    worker->join();
+  }
+}
+
+void Scheduler::enqueue(const std::shared_ptr<AbstractTask>& task) {
+  Assert(!_is_shutting_down, "Tasks cannot be enqueued after the scheduler was finished.");
+  DebugAssert(task->is_ready(), "Only ready tasks can be enqueued.");
+
+  const auto queue = _select_queue(*task);
+
+  ++_active_task_count;
+  ++_queued_task_count;
+  queue->push(task);
+
+  // Taking the mutex ensures that no worker is between checking for work and going to sleep
+  { std::lock_guard lock(_mutex); }
+  _work_condition.notify_one();
+  if (_waiting_worker_count > 0) _waiting_worker_condition.notify_all();
+}
+
+std::shared_ptr<TaskQueue> Scheduler::_select_queue(const AbstractTask& task) {
+  auto worker = Worker::get_this_thread_worker();
+  if (worker && &worker->scheduler() != this) worker = nullptr;
+
+  // Tasks of nodes without workers (or of nodes of a previous topology) can run anywhere
+  const auto node_id = task.node_id();
+  if (node_id < _node_workers.size() && !_node_workers[node_id].empty()) {
+    if (worker && worker->node_id() == node_id) return worker->queue();
+
+    const auto& node_workers = _node_workers[node_id];
+    return _queues[node_workers[_next_queue++ % node_workers.size()]];
+  }
+
+  // Sub-tasks stay with the worker that created them, as they likely work on the data it has in its cache
+  if (worker) return worker->queue();
+  return _queues[_next_queue++ % _queues.size()];
+}
+
+const std::vector<std::shared_ptr<TaskQueue>>& Scheduler::queues() const { return _queues; }
+
+const std::vector<std::shared_ptr<Worker>>& Scheduler::workers() const { return _workers; }
+
+std::shared_ptr<AbstractTask> Scheduler::get_task(const WorkerID worker_id) {
+  DebugAssert(worker_id < _queues.size(), "Worker does not exist.");
+  if (_queued_task_count == 0) return nullptr;
+
+  auto task = _queues[worker_id]->pull();
+  for (auto it = _steal_order[worker_id].cbegin(); !task && it != _steal_order[worker_id].cend(); ++it) {
+    task = _queues[*it]->steal();
+  }
+
+  if (task) --_queued_task_count;
+  return task;
+}
+
+void Scheduler::execute(AbstractTask& task) {
+  // Successors that become ready are enqueued by task.execute, so the count does not drop to zero in between
+  task.execute();
+
+  // Workers might wait for this task. As they count themselves as waiting before they check whether their tasks are
+  // done, they either see the task done or are notified.
+  if (_waiting_worker_count > 0) {
+    { std::lock_guard lock(_mutex); }
+    _waiting_worker_condition.notify_all();
+  }
+
+  if (--_active_task_count == 0) {
+    { std::lock_guard lock(_mutex); }
+    _done_condition.notify_all();
+  }
+}
+
+bool Scheduler::wait_for_work() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  // The timeout guards against missed notifications, e.g., of tasks that were enqueued to a queue of a busy worker
+  _work_condition.wait_for(lock, std::chrono::milliseconds{10},
+                           [&]() { return _is_shutting_down || _queued_task_count > 0; });
+  return !_is_shutting_down || _queued_task_count > 0;
+}
+
+void Scheduler::wait_for_work_or_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  ++_waiting_worker_count;
+  {
+    auto lock = std::unique_lock<std::mutex>{_mutex};
+    // The timeout guards against missed notifications, e.g., of tasks that were not executed by this scheduler
+    _waiting_worker_condition.wait_for(lock, std::chrono::milliseconds{10}, [&]() {
+      return _queued_task_count > 0 ||
+             std::all_of(tasks.cbegin(), tasks.cend(), [](const auto& task) { return task->is_done(); });
+    });
+  }
+  --_waiting_worker_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "topology.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskQueue;
+class Worker;
+
+/**
+ * Executes tasks on a fixed number of worker threads, usually one per core. Every worker has its own queue. Tasks that
+ * are enqueued by a worker (e.g., the sub-tasks of an operator) go to its own queue, other tasks are distributed
+ * round-robin. Workers whose queues run empty steal tasks from the other queues, so that the load stays balanced.
+ *
+ * Workers are bound to the CPUs of the Topology and thereby to its NUMA nodes. Tasks that prefer a node (see
+ * AbstractTask::node_id), e.g., because they scan a chunk assigned to it, are enqueued to a worker of that node. Idle
+ * workers steal from the workers of their own node first, so tasks only move to another node if their node is busy.
+ *
+ * Tasks are usually not enqueued directly but scheduled (see AbstractTask::schedule) after the scheduler was set as
+ * the CurrentScheduler.
+ */
+class Scheduler : private Noncopyable {
+ public:
+  // creates worker_count workers, which are assigned to the CPUs of the Topology in order
+  explicit Scheduler(const size_t worker_count = Topology::get().cpu_count());
+
+  // finishes the scheduler, if that did not happen yet
+  ~Scheduler();
+
+  // waits until all enqueued tasks are done and then terminates the workers
+  void finish();
+
+  // adds a ready task to a queue, from which a worker will execute it
+  void enqueue(const std::shared_ptr<AbstractTask>& task);
+
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const;
+
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+
+  // Returns the next task for the worker, taken from its own queue or stolen from another queue. Returns nullptr if
+  // all queues are empty.
+  std::shared_ptr<AbstractTask> get_task(const WorkerID worker_id);
+
+  // executes a task that was returned by get_task
+  void execute(AbstractTask& task);
+
+  // Blocks an idle worker until new tasks are enqueued. Returns false if the worker should terminate instead.
+  bool wait_for_work();
+
+  // Blocks a worker that waits for tasks (see Worker::wait_for_tasks) until new tasks are enqueued or all of the tasks
+  // are done
+  void wait_for_work_or_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  // returns the queue for a task, preferring the workers of its node and then the worker that enqueues it
+  std::shared_ptr<TaskQueue> _select_queue(const AbstractTask& task);
+
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::shared_ptr<Worker>> _workers;
+
+  // the workers of each node, and for each worker the other workers in the order in which it steals from them
+  std::vector<std::vector<WorkerID>> _node_workers;
+  std::vector<std::vector<WorkerID>> _steal_order;
+
+  std::atomic<size_t> _next_queue{0};
+
+  // number of tasks in the queues and number of enqueued tasks that are not done yet
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _active_task_count{0};
+
+  // number of workers in wait_for_work_or_tasks, which are woken up whenever a task is done
+  std::atomic<size_t> _waiting_worker_count{0};
+
+  std::atomic<bool> _is_shutting_down{false};
+  std::mutex _mutex;
+  std::condition_variable _work_condition;
+  std::condition_variable _waiting_worker_condition;
+  std::condition_variable _done_condition;
+};
+
+}  // namespace opossum
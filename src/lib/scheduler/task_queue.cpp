@@ -0,0 +1,39 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void TaskQueue::push(const std::shared_ptr<AbstractTask>& task) {
+  std::lock_guard lock(_mutex);
+  _tasks.emplace_back(task);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull() {
+  std::lock_guard lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.back());
+  _tasks.pop_back();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  std::lock_guard lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.front());
+  _tasks.pop_front();
+  return task;
+}
+
+size_t TaskQueue::size() const {
+  std::lock_guard lock(_mutex);
+  return _tasks.size();
+}
+
+}  // namespace opossum
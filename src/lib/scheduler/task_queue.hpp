@@ -0,0 +1,34 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * The queue of a Worker. The worker takes the task that was pushed last (which was likely pushed by itself and still
+ * has its data in the cache), while idle workers steal the oldest tasks from the queues of others.
+ */
+class TaskQueue : private Noncopyable {
+ public:
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // returns the most recently pushed task, or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+
+  // returns the least recently pushed task, or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> steal();
+
+  size_t size() const;
+
+ protected:
+  mutable std::mutex _mutex;
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+};
+
+}  // namespace opossum
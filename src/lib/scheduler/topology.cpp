@@ -0,0 +1,98 @@
+#include "topology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Topology& Topology::get() {
+  static Topology topology;
+  return topology;
+}
+
+Topology::Topology() { use_numa_topology(); }
+
+void Topology::use_numa_topology(const std::string& node_directory) {
+  _nodes.clear();
+  _is_fake = false;
+
+  // The numbers of the nodes that are online, which may have gaps
+  auto online_file = std::ifstream{node_directory + "/online"};
+  auto online_list = std::string{};
+  if (online_file) std::getline(online_file, online_list);
+
+  for (const auto node_number : _parse_list(online_list)) {
+    auto file = std::ifstream{node_directory + "/node" + std::to_string(node_number) + "/cpulist"};
+    auto cpu_list = std::string{};
+    if (!file || !std::getline(file, cpu_list)) continue;
+
+    auto cpus = _parse_list(cpu_list);
+    // Nodes without CPUs (e.g., memory-only nodes) cannot run workers
+    if (cpus.empty()) continue;
+    _nodes.emplace_back(TopologyNode{std::move(cpus)});
+  }
+
+  if (_nodes.empty()) {
+    auto& node = _nodes.emplace_back();
+    for (auto cpu_id = CpuID{0}; cpu_id < std::max(std::thread::hardware_concurrency(), 1u); ++cpu_id) {
+      node.cpus.emplace_back(cpu_id);
+    }
+  }
+}
+
+void Topology::use_fake_numa_topology(const uint32_t node_count, const uint32_t cpus_per_node) {
+  Assert(node_count > 0 && cpus_per_node > 0, "Topology needs at least one node with one CPU.");
+
+  _nodes.clear();
+  _is_fake = true;
+
+  auto next_cpu_id = CpuID{0};
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    auto& node = _nodes.emplace_back();
+    for (auto index = uint32_t{0}; index < cpus_per_node; ++index) {
+      node.cpus.emplace_back(next_cpu_id++);
+    }
+  }
+}
+
+const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
+
+size_t Topology::node_count() const { return _nodes.size(); }
+
+size_t Topology::cpu_count() const {
+  auto cpu_count = size_t{0};
+  for (const auto& node : _nodes) {
+    cpu_count += node.cpus.size();
+  }
+  return cpu_count;
+}
+
+bool Topology::is_fake() const { return _is_fake; }
+
+void Topology::reset() { use_numa_topology(); }
+
+std::vector<uint32_t> Topology::_parse_list(const std::string& list) {
+  auto numbers = std::vector<uint32_t>{};
+  auto stream = std::stringstream{list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+
+    const auto dash = range.find('-');
+    const auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+    const auto last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+    for (auto number = first; number <= last; ++number) {
+      numbers.emplace_back(number);
+    }
+  }
+  return numbers;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct TopologyNode {
+  std::vector<CpuID> cpus;
+};
+
+/**
+ * The NUMA nodes of the machine and their CPUs. The Scheduler binds its workers to them, and chunks are assigned to
+ * these nodes (see Table::set_chunk_node_affinity), so that tasks working on the same chunk prefer the same node.
+ *
+ * The topology is read from /sys/devices/system/node. Nodes are numbered consecutively here, even if the machine's node
+ * numbers have gaps (e.g., after hotplugging). On machines without NUMA support, it consists of a single node with all
+ * CPUs. For testing on such machines, a fake topology with several nodes can be set up. Its CPUs do not
+ * exist, so workers of a fake topology are not pinned to them.
+ */
+class Topology : private Noncopyable {
+ public:
+  static Topology& get();
+
+  // detects the topology of the machine. The directory can be changed for testing.
+  void use_numa_topology(const std::string& node_directory = "/sys/devices/system/node");
+
+  // pretends that the machine has node_count nodes with cpus_per_node CPUs each
+  void use_fake_numa_topology(const uint32_t node_count, const uint32_t cpus_per_node);
+
+  const std::vector<TopologyNode>& nodes() const;
+
+  size_t node_count() const;
+
+  size_t cpu_count() const;
+
+  bool is_fake() const;
+
+  // returns to the topology of the machine, used especially in tests
+  void reset();
+
+  Topology(Topology&&) = delete;
+
+ protected:
+  Topology();
+
+  // parses a list of CPU or node numbers like "0-3,8,10-11"
+  static std::vector<uint32_t> _parse_list(const std::string& list);
+
+  std::vector<TopologyNode> _nodes;
+  bool _is_fake{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,93 @@
+#include "worker.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+thread_local Worker* this_thread_worker = nullptr;
+
+}  // namespace
+
+Worker::Worker(Scheduler& scheduler, const WorkerID id, const NodeID node_id, const CpuID cpu_id,
+               const std::shared_ptr<TaskQueue>& queue)
+    : _scheduler(scheduler), _id(id), _node_id(node_id), _cpu_id(cpu_id), _queue(queue) {}
+
+Worker* Worker::get_this_thread_worker() { return this_thread_worker; }
+
+WorkerID Worker::id() const { return _id; }
+
+NodeID Worker::node_id() const { return _node_id; }
+
+CpuID Worker::cpu_id() const { return _cpu_id; }
+
+const std::shared_ptr<TaskQueue>& Worker::queue() const { return _queue; }
+
+const Scheduler& Worker::scheduler() const { return _scheduler; }
+
+void Worker::start(const bool pin) {
+  Assert(!_thread.joinable(), "Worker was already started.");
+  _thread = std::thread(&Worker::_work, this, pin);
+}
+
+void Worker::join() {
+  if (_thread.joinable()) _thread.join();
+}
+
+void Worker::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  DebugAssert(get_this_thread_worker() == this, "Worker can only wait on its own thread.");
+
+  const auto all_done = [&]() {
+    return std::all_of(tasks.cbegin(), tasks.cend(), [](const auto& task) { return task->is_done(); });
+  };
+
+  while (!all_done()) {
+    // The remaining tasks are being executed by other workers, so sleep until they are done or there is other work
+    if (!_work_on_next_task()) _scheduler.wait_for_work_or_tasks(tasks);
+  }
+}
+
+void Worker::_work(const bool pin) {
+  this_thread_worker = this;
+  if (pin) _pin_to_cpu();
+
+  while (true) {
+    if (_work_on_next_task()) continue;
+    if (!_scheduler.wait_for_work()) break;
+  }
+
+  this_thread_worker = nullptr;
+}
+
+void Worker::_pin_to_cpu() const {
+#ifdef __linux__
+  auto cpu_set = cpu_set_t{};
+  CPU_ZERO(&cpu_set);
+  CPU_SET(_cpu_id, &cpu_set);
+  // Failing to pin (e.g., because the CPU is not available to the process) only costs locality
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
+bool Worker::_work_on_next_task() {
+  const auto task = _scheduler.get_task(_id);
+  if (!task) return false;
+
+  _scheduler.execute(*task);
+  return true;
+}
+
+}  // namespace opossum
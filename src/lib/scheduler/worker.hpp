@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class Scheduler;
+class TaskQueue;
+
+/**
+ * A thread of the Scheduler. It executes the tasks of its own queue and, once that is empty, steals tasks from the
+ * queues of the other workers, starting with the workers of its own NUMA node. On machines with several nodes, the
+ * thread is pinned to its CPU.
+ */
+class Worker : private Noncopyable {
+ public:
+  Worker(Scheduler& scheduler, const WorkerID id, const NodeID node_id, const CpuID cpu_id,
+         const std::shared_ptr<TaskQueue>& queue);
+
+  // returns the worker that runs on the calling thread, or nullptr if it is not a worker thread
+  static Worker* get_this_thread_worker();
+
+  WorkerID id() const;
+
+  NodeID node_id() const;
+
+  CpuID cpu_id() const;
+
+  const std::shared_ptr<TaskQueue>& queue() const;
+
+  const Scheduler& scheduler() const;
+
+  // starts the thread of the worker, pinned to its CPU if pin is true
+  void start(const bool pin);
+
+  // waits for the thread of the worker to terminate, which it does once the scheduler shuts down
+  void join();
+
+  // Executes other tasks until all tasks are done, so that a task that waits for its sub-tasks (e.g., the morsels of
+  // an operator) does not block the worker. If there are no other tasks, the worker sleeps instead of spinning.
+  void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  void _work(const bool pin);
+
+  void _pin_to_cpu() const;
+
+  // executes a single task, if there is one. Returns whether a task was executed.
+  bool _work_on_next_task();
+
+  Scheduler& _scheduler;
+  const WorkerID _id;
+  const NodeID _node_id;
+  const CpuID _cpu_id;
+  const std::shared_ptr<TaskQueue> _queue;
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * SegmentPosition is the value type of all segment iterators. It bundles a typed value with the offset of that value
+ * within the iterated segment (for a ReferenceSegment, this is the offset within the ReferenceSegment, not within the
+ * referenced segment).
+ *
+ * The value is held by reference. It points into the ValueSegment or the dictionary of the DictionarySegment that
+ * stores it, which are guaranteed to outlive the iteration.
+ */
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const T& value, const ChunkOffset chunk_offset) : _value{value}, _chunk_offset{chunk_offset} {}
+
+  const T& value() const { return _value; }
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ private:
+  const T& _value;
+  const ChunkOffset _chunk_offset;
+};
+
+/**
+ * Base class of all segment iterators. Derived classes have to implement the following methods, which are called by
+ * boost::iterator_facade:
+ *
+ *   void increment();
+ *   void decrement();
+ *   void advance(std::ptrdiff_t n);
+ *   bool equal(const Derived& other) const;
+ *   std::ptrdiff_t distance_to(const Derived& other) const;
+ *   SegmentPosition<T> dereference() const;
+ *
+ * As dereference() returns a SegmentPosition by value, the iterators are not LegacyForwardIterators in terms of the
+ * standard, but they can be used with all range-based algorithms that only rely on the boost traversal category.
+ */
+template <typename Derived, typename T>
+using BaseSegmentIterator =
+    boost::iterator_facade<Derived, SegmentPosition<T>, boost::random_access_traversal_tag, SegmentPosition<T>>;
+
+/**
+ * Base class of all segment iterables. Iterables are light-weight wrappers around a concrete segment type that know
+ * how to create iterators for it. Operators resolve a BaseSegment only once per chunk (see segment_iterate.hpp) and
+ * then work with the concrete, inlinable iterators.
+ *
+ * Derived classes implement
+ *
+ *   template <typename Functor>
+ *   void _on_with_iterators(const Functor& functor) const;
+ *
+ * which calls functor(begin, end) with the begin and end iterator of the segment. Because begin and end are passed to
+ * a generic lambda, each iterator type gets its own instantiation of the lambda's body.
+ *
+ * Iterables of segments that store values (i.e., not ReferenceSegments) additionally implement
+ *
+ *   template <typename Functor>
+ *   void _on_with_iterators(const PosList& position_filter, const Functor& functor) const;
+ *
+ * which only visits the offsets listed in position_filter. This is used to iterate over a ReferenceSegment whose
+ * positions all point into the same segment.
+ *
+ * Example:
+ *
+ *   ValueSegmentIterable<int32_t>{value_segment}.with_iterators([&](auto it, const auto end) {
+ *     for (; it != end; ++it) {
+ *       sum += it->value();
+ *     }
+ *   });
+ */
+template <typename Derived>
+class BaseSegmentIterable {
+ public:
+  template <typename Functor>
+  void with_iterators(const Functor& functor) const {
+    static_cast<const Derived&>(*this)._on_with_iterators(functor);
+  }
+
+  template <typename Functor>
+  void with_iterators(const PosList& position_filter, const Functor& functor) const {
+    static_cast<const Derived&>(*this)._on_with_iterators(position_filter, functor);
+  }
+
+  // calls functor(const SegmentPosition<T>&) for every value in the segment
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    with_iterators([&](auto it, const auto end) {
+      for (; it != end; ++it) {
+        functor(*it);
+      }
+    });
+  }
+};
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -9,6 +10,7 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
 
 #include "utils/assert.hpp"
 
@@ -19,11 +21,21 @@ void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_b
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == _segments.size(),
               "Number of passed arguments does not equal the number of stored columns.");
+  // Check this before modifying any segment, so that the chunk and its indexes stay consistent if it fails
+  for (const auto& index : _indexes) {
+    Assert(index->supports_append(), "Chunk has an index that does not support appending rows.");
+  }
+
   auto value_iter = values.cbegin();
   for (const auto& segment : _segments) {
     segment->append(*value_iter);
     ++value_iter;
   }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  for (const auto& index : _indexes) {
+    index->on_append(chunk_offset);
+  }
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments[column_id]; }
@@ -38,4 +50,35 @@ uint32_t Chunk::size() const {
   }
 }
 
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  const auto segments = _get_segments(column_ids);
+
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>{};
+  for (const auto& index : _indexes) {
+    if (index->is_index_for(segments)) indexes.emplace_back(index);
+  }
+  return indexes;
+}
+
+const std::vector<std::shared_ptr<BaseIndex>>& Chunk::get_indexes() const { return _indexes; }
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  const auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
+  DebugAssert(it != _indexes.cend(), "Trying to remove an index that is not attached to the chunk.");
+  _indexes.erase(it);
+}
+
+NodeID Chunk::node_id() const { return _node_id; }
+
+void Chunk::set_node_id(const NodeID node_id) { _node_id = node_id; }
+
+std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments(const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto& column_id : column_ids) {
+    segments.emplace_back(get_segment(column_id));
+  }
+  return segments;
+}
+
 }  // namespace opossum
@@ -45,8 +45,37 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Creates an index of type Index on the segments of the given columns and attaches it to the chunk. Rows added by
+  // append are added to all indexes of the chunk. If one of them does not support appends (see
+  // BaseIndex::supports_append), append fails without modifying the chunk. Attaching and removing indexes is not
+  // thread-safe.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    const auto index = std::make_shared<Index>(_get_segments(column_ids));
+    _indexes.emplace_back(index);
+    return index;
+  }
+
+  // returns all indexes on exactly the given columns, in the given order
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // returns all indexes attached to the chunk
+  const std::vector<std::shared_ptr<BaseIndex>>& get_indexes() const;
+
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // Returns the NUMA node (see Topology) that tasks working on the chunk prefer. This is a hint for the scheduler, the
+  // chunk's memory is not bound to the node. Tables assign nodes to their chunks when they are added, unless they
+  // already have one, e.g., the node of the input chunk they were derived from.
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+
  protected:
+  std::vector<std::shared_ptr<const BaseSegment>> _get_segments(const std::vector<ColumnID>& column_ids) const;
+
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+  NodeID _node_id{ANY_NODE_ID};
 };
 
 }  // namespace opossum
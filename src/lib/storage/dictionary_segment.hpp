@@ -58,7 +58,7 @@ class DictionarySegment : public BaseSegment {
 
   // return the value at a certain position.
   const T get(const size_t offset) const {
-    DebugAssert(offset < _dictionary->size(), "Offset is out of bounds.");
+    DebugAssert(offset < size(), "Offset is out of bounds.");
     return (*_dictionary)[_attribute_vector->get(offset)];
   }
 
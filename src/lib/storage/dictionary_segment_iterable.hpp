@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment_iterable.hpp"
+#include "dictionary_segment.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over a DictionarySegment and decodes the value ids on the fly. The width of the attribute vector is resolved
+ * once in _on_with_iterators so that the iterator reads the value ids directly from the vector instead of calling the
+ * virtual BaseAttributeVector::get for every row.
+ */
+template <typename T>
+class DictionarySegmentIterable : public BaseSegmentIterable<DictionarySegmentIterable<T>> {
+ public:
+  explicit DictionarySegmentIterable(const DictionarySegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _resolve_value_ids([&](const auto& value_ids) {
+      using ValueIDType = typename std::decay_t<decltype(value_ids)>::value_type;
+      const auto& dictionary = *_segment.dictionary();
+      functor(Iterator<ValueIDType>{dictionary, value_ids, 0u},
+              Iterator<ValueIDType>{dictionary, value_ids, static_cast<ChunkOffset>(value_ids.size())});
+    });
+  }
+
+  // Accesses only the offsets given in position_filter, which all have to reference this segment. The chunk_offset of
+  // the returned positions is the index within position_filter.
+  template <typename Functor>
+  void _on_with_iterators(const PosList& position_filter, const Functor& functor) const {
+    _resolve_value_ids([&](const auto& value_ids) {
+      using ValueIDType = typename std::decay_t<decltype(value_ids)>::value_type;
+      const auto& dictionary = *_segment.dictionary();
+      functor(PointAccessIterator<ValueIDType>{dictionary, value_ids, position_filter, 0u},
+              PointAccessIterator<ValueIDType>{dictionary, value_ids, position_filter,
+                                               static_cast<ChunkOffset>(position_filter.size())});
+    });
+  }
+
+  // Iterates sequentially over the value ids of the attribute vector and looks up their values in the dictionary
+  template <typename ValueIDType>
+  class Iterator : public BaseSegmentIterator<Iterator<ValueIDType>, T> {
+   public:
+    Iterator(const std::vector<T>& dictionary, const std::vector<ValueIDType>& value_ids,
+             const ChunkOffset chunk_offset)
+        : _dictionary{&dictionary}, _value_ids{&value_ids}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+    void decrement() { --_chunk_offset; }
+    void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      return {(*_dictionary)[(*_value_ids)[_chunk_offset]], _chunk_offset};
+    }
+
+    const std::vector<T>* _dictionary;
+    const std::vector<ValueIDType>* _value_ids;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename ValueIDType>
+  class PointAccessIterator : public BaseSegmentIterator<PointAccessIterator<ValueIDType>, T> {
+   public:
+    PointAccessIterator(const std::vector<T>& dictionary, const std::vector<ValueIDType>& value_ids,
+                        const PosList& position_filter, const ChunkOffset chunk_offset)
+        : _dictionary{&dictionary},
+          _value_ids{&value_ids},
+          _position_filter{&position_filter},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+    void decrement() { --_chunk_offset; }
+    void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+    bool equal(const PointAccessIterator& other) const { return _chunk_offset == other._chunk_offset; }
+    std::ptrdiff_t distance_to(const PointAccessIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto referenced_offset = (*_position_filter)[_chunk_offset].chunk_offset;
+      return {(*_dictionary)[(*_value_ids)[referenced_offset]], _chunk_offset};
+    }
+
+    const std::vector<T>* _dictionary;
+    const std::vector<ValueIDType>* _value_ids;
+    const PosList* _position_filter;
+    ChunkOffset _chunk_offset;
+  };
+
+ protected:
+  const DictionarySegment<T>& _segment;
+
+  // calls functor with the value ids of the attribute vector as std::vector<uint8_t|uint16_t|uint32_t>
+  template <typename Functor>
+  void _resolve_value_ids(const Functor& functor) const {
+    resolve_fitted_attribute_vector(*_segment.attribute_vector(), functor);
+  }
+};
+
+}  // namespace opossum
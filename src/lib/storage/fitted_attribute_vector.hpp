@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -41,7 +43,37 @@ class FittedAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const { return AttributeVectorWidth{sizeof(T)}; }
 
+  // returns all value ids. Use this instead of get() when iterating over the whole vector, as it avoids a virtual
+  // call per value.
+  const std::vector<T>& values() const { return _values; }
+
  protected:
   std::vector<T> _values;
 };
+
+// Resolves the width of attribute_vector, which has to be a FittedAttributeVector, and calls functor with its value
+// ids as std::vector<uint8_t|uint16_t|uint32_t>. This avoids a virtual call per value id.
+template <typename Functor>
+void resolve_fitted_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  const auto resolve = [&](auto value_id_type) {
+    using ValueIDType = decltype(value_id_type);
+    DebugAssert(dynamic_cast<const FittedAttributeVector<ValueIDType>*>(&attribute_vector),
+                "Attribute vector width does not match its type.");
+    functor(static_cast<const FittedAttributeVector<ValueIDType>&>(attribute_vector).values());
+  };
+
+  switch (attribute_vector.width()) {
+    case 1:
+      resolve(uint8_t{});
+      return;
+    case 2:
+      resolve(uint16_t{});
+      return;
+    case 4:
+      resolve(uint32_t{});
+      return;
+    default:
+      throw std::logic_error("Unsupported attribute vector width.");
+  }
+}
 }  // namespace opossum
@@ -0,0 +1,338 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Writes the bytes of a string to out, escaping 0x00 as 0x00 0xFF. Without the terminator, this is the key of a
+// prefix.
+template <typename OutputIterator>
+OutputIterator write_string_bytes(const std::string& value, OutputIterator out) {
+  for (const auto character : value) {
+    const auto byte = static_cast<uint8_t>(character);
+    *out++ = byte;
+    if (byte == 0) *out++ = 0xFF;
+  }
+  return out;
+}
+
+// Writes the binary-comparable key of value to out and returns the iterator behind it
+template <typename T, typename OutputIterator>
+OutputIterator write_key_bytes(const T& value, OutputIterator out) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    out = write_string_bytes(value, out);
+    *out++ = 0x00;
+    *out++ = 0x00;
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = Bits{};
+    if constexpr (std::is_integral_v<T>) {
+      bits = static_cast<Bits>(value) ^ sign_bit;
+    } else {
+      // -0.0 equals 0.0, so both have to get the same key
+      const auto normalized = value == T{0} ? T{0} : value;
+      std::memcpy(&bits, &normalized, sizeof(T));
+      bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    }
+
+    for (auto shift = sizeof(T) * 8; shift > 0; shift -= 8) {
+      *out++ = static_cast<uint8_t>(bits >> (shift - 8));
+    }
+  }
+  return out;
+}
+
+// returns the number of bytes that write_key_bytes writes for value
+template <typename T>
+size_t key_size(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return value.size() + std::count(value.cbegin(), value.cend(), '\0') + 2;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename T>
+void append_key_bytes(const T& value, std::vector<uint8_t>& key) {
+  write_key_bytes(value, std::back_inserter(key));
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments)
+    : _indexed_segments(segments) {
+  Assert(!_indexed_segments.empty(), "AdaptiveRadixTreeIndex requires at least one segment.");
+  const auto row_count = _indexed_segments.front()->size();
+
+  auto segment_data_types = std::vector<std::string>{};
+  for (const auto& segment : _indexed_segments) {
+    Assert(segment->size() == row_count, "Indexed segments must be of the same chunk.");
+
+    const auto segment_count = segment_data_types.size();
+    hana::for_each(data_types, [&](auto type_pair) {
+      using DataType = typename decltype(+hana::second(type_pair))::type;
+      if (!std::dynamic_pointer_cast<const ValueSegment<DataType>>(segment) &&
+          !std::dynamic_pointer_cast<const DictionarySegment<DataType>>(segment)) {
+        return;
+      }
+
+      segment_data_types.emplace_back(hana::first(type_pair));
+      _append_key_bytes.emplace_back([](const AllTypeVariant& value, std::vector<uint8_t>& key) {
+        append_key_bytes(type_cast<DataType>(value), key);
+      });
+    });
+    Assert(segment_data_types.size() > segment_count,
+           "AdaptiveRadixTreeIndex requires ValueSegments or DictionarySegments.");
+  }
+  _indexes_strings = _indexed_segments.size() == 1 && segment_data_types.front() == "string";
+
+  auto keys = std::vector<std::vector<uint8_t>>{};
+  auto key_starts = std::vector<ChunkOffset>{};
+  _offsets.resize(row_count);
+
+  if (_indexed_segments.size() == 1) {
+    resolve_data_type(segment_data_types.front(), [&](auto type) {
+      using DataType = typename decltype(type)::type;
+
+      // Sort the rows by their values, keeping rows with equal values ordered by their offsets. Then, each distinct
+      // value is encoded once.
+      auto entries = std::vector<std::pair<DataType, ChunkOffset>>{};
+      entries.reserve(row_count);
+      segment_iterate<DataType>(*_indexed_segments.front(), [&](const auto& position) {
+        entries.emplace_back(position.value(), position.chunk_offset());
+      });
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+      for (auto index = size_t{0}; index < entries.size(); ++index) {
+        if (index == 0 || entries[index - 1].first < entries[index].first) {
+          auto& key = keys.emplace_back();
+          key.reserve(key_size(entries[index].first));
+          append_key_bytes(entries[index].first, key);
+          key_starts.emplace_back(static_cast<ChunkOffset>(index));
+        }
+        _offsets[index] = entries[index].second;
+      }
+    });
+  } else {
+    // The key of a row is the concatenation of the keys of its values. The keys of all rows are stored in one buffer,
+    // the key of row i from key_begins[i] to key_begins[i + 1]. First, the size of each key is determined, then the
+    // values of each segment are written behind those of the previous segments.
+    auto key_begins = std::vector<size_t>(row_count + 1, 0);
+    for (auto segment_index = size_t{0}; segment_index < _indexed_segments.size(); ++segment_index) {
+      resolve_data_type(segment_data_types[segment_index], [&](auto type) {
+        using DataType = typename decltype(type)::type;
+        segment_iterate<DataType>(*_indexed_segments[segment_index], [&](const auto& position) {
+          key_begins[position.chunk_offset() + 1] += key_size(position.value());
+        });
+      });
+    }
+    std::partial_sum(key_begins.cbegin(), key_begins.cend(), key_begins.begin());
+
+    auto key_bytes = std::vector<uint8_t>(key_begins.back());
+    auto key_ends = std::vector<size_t>(key_begins.cbegin(), key_begins.cend() - 1);
+    for (auto segment_index = size_t{0}; segment_index < _indexed_segments.size(); ++segment_index) {
+      resolve_data_type(segment_data_types[segment_index], [&](auto type) {
+        using DataType = typename decltype(type)::type;
+        segment_iterate<DataType>(*_indexed_segments[segment_index], [&](const auto& position) {
+          auto& key_end = key_ends[position.chunk_offset()];
+          key_end = write_key_bytes(position.value(), key_bytes.data() + key_end) - key_bytes.data();
+        });
+      });
+    }
+
+    // Sort the rows by their keys, keeping rows with equal keys ordered by their offsets, and collect the distinct keys
+    const auto key_begin = [&](const ChunkOffset row) { return key_bytes.cbegin() + key_begins[row]; };
+    const auto key_end = [&](const ChunkOffset row) { return key_bytes.cbegin() + key_begins[row + 1]; };
+    std::iota(_offsets.begin(), _offsets.end(), ChunkOffset{0});
+    std::stable_sort(_offsets.begin(), _offsets.end(), [&](const auto lhs, const auto rhs) {
+      return std::lexicographical_compare(key_begin(lhs), key_end(lhs), key_begin(rhs), key_end(rhs));
+    });
+
+    for (auto index = ChunkOffset{0}; index < row_count; ++index) {
+      const auto row = _offsets[index];
+      if (keys.empty() || !std::equal(keys.back().cbegin(), keys.back().cend(), key_begin(row), key_end(row))) {
+        keys.emplace_back(key_begin(row), key_end(row));
+        key_starts.emplace_back(index);
+      }
+    }
+  }
+  key_starts.emplace_back(row_count);
+
+  _offsets_block = OffsetBlock{_offsets.data(), _offsets.data() + _offsets.size(), nullptr};
+  if (!keys.empty()) _root = _build(keys, key_starts, 0, keys.size(), 0);
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> AdaptiveRadixTreeIndex::prefix_range(
+    const std::string& prefix) const {
+  Assert(_indexes_strings, "Prefix lookups are only supported for string segments.");
+
+  auto key = std::vector<uint8_t>{};
+  write_string_bytes(prefix, std::back_inserter(key));
+
+  // Descend along the prefix until all of its bytes are matched. All keys in the subtree below that point start with
+  // the prefix.
+  const auto* node = _root.get();
+  auto depth = size_t{0};
+  while (node) {
+    if (node->is_leaf()) {
+      const auto& leaf_key = static_cast<const ARTLeaf&>(*node).key;
+      if (leaf_key.size() >= key.size() && std::equal(key.cbegin(), key.cend(), leaf_key.cbegin())) break;
+      node = nullptr;
+      break;
+    }
+
+    const auto& inner_node = static_cast<const ARTInnerNode&>(*node);
+    const auto compared_bytes = std::min(inner_node.prefix.size(), key.size() - depth);
+    if (!std::equal(inner_node.prefix.cbegin(), inner_node.prefix.cbegin() + compared_bytes, key.cbegin() + depth)) {
+      node = nullptr;
+      break;
+    }
+
+    depth += compared_bytes;
+    if (depth == key.size()) break;
+    node = inner_node.child(key[depth]);
+    ++depth;
+  }
+
+  if (!node) return {cend(), cend()};
+  return {_iterator(node->begin), _iterator(node->end)};
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_on_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto position = _root ? _search<false>(*_root, _encode(values), 0) : std::nullopt;
+  return _iterator(position.value_or(static_cast<ChunkOffset>(_offsets.size())));
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_on_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  const auto position = _root ? _search<true>(*_root, _encode(values), 0) : std::nullopt;
+  return _iterator(position.value_or(static_cast<ChunkOffset>(_offsets.size())));
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_on_cbegin() const { return _iterator(0); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_on_cend() const {
+  return _iterator(static_cast<ChunkOffset>(_offsets.size()));
+}
+
+std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_on_get_indexed_segments() const {
+  return _indexed_segments;
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build(std::vector<std::vector<uint8_t>>& keys,
+                                                        const std::vector<ChunkOffset>& key_starts, const size_t begin,
+                                                        const size_t end, const size_t depth) {
+  if (end - begin == 1) return std::make_unique<ARTLeaf>(key_starts[begin], key_starts[end], std::move(keys[begin]));
+
+  // As the keys are sorted, the bytes shared by all of them are those shared by the first and the last one. Since no
+  // key is a prefix of another, they differ before either of them ends.
+  const auto& first_key = keys[begin];
+  const auto& last_key = keys[end - 1];
+  auto branch_depth = depth;
+  while (first_key[branch_depth] == last_key[branch_depth]) ++branch_depth;
+
+  // Group the keys by their byte at branch_depth before the leaves take ownership of the keys
+  auto child_begins = std::vector<size_t>{};
+  for (auto index = begin; index < end; ++index) {
+    if (index == begin || keys[index - 1][branch_depth] != keys[index][branch_depth]) child_begins.emplace_back(index);
+  }
+  child_begins.emplace_back(end);
+  const auto child_count = child_begins.size() - 1;
+
+  auto prefix = std::vector<uint8_t>(first_key.cbegin() + depth, first_key.cbegin() + branch_depth);
+  auto child_bytes = std::vector<uint8_t>(child_count);
+  for (auto child_index = size_t{0}; child_index < child_count; ++child_index) {
+    child_bytes[child_index] = keys[child_begins[child_index]][branch_depth];
+  }
+
+  auto node = std::unique_ptr<ARTInnerNode>{};
+  if (child_count <= 4) {
+    node = std::make_unique<ARTNode4>(key_starts[begin], key_starts[end], std::move(prefix));
+  } else if (child_count <= 16) {
+    node = std::make_unique<ARTNode16>(key_starts[begin], key_starts[end], std::move(prefix));
+  } else if (child_count <= 48) {
+    node = std::make_unique<ARTNode48>(key_starts[begin], key_starts[end], std::move(prefix));
+  } else {
+    node = std::make_unique<ARTNode256>(key_starts[begin], key_starts[end], std::move(prefix));
+  }
+
+  for (auto child_index = size_t{0}; child_index < child_count; ++child_index) {
+    node->add_child(child_bytes[child_index], _build(keys, key_starts, child_begins[child_index],
+                                                     child_begins[child_index + 1], branch_depth + 1));
+  }
+  return node;
+}
+
+std::vector<uint8_t> AdaptiveRadixTreeIndex::_encode(const std::vector<AllTypeVariant>& values) const {
+  auto key = std::vector<uint8_t>{};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    _append_key_bytes[index](values[index], key);
+  }
+  return key;
+}
+
+template <bool Upper>
+std::optional<ChunkOffset> AdaptiveRadixTreeIndex::_search(const ARTNode& node, const std::vector<uint8_t>& key,
+                                                           size_t depth) {
+  // The key can be shorter than the keys in the tree if values were only passed for the first segments. Keys in the
+  // tree that start with it are then considered equal to it.
+  if (node.is_leaf()) {
+    const auto& leaf_key = static_cast<const ARTLeaf&>(node).key;
+    const auto mismatch = std::mismatch(leaf_key.cbegin(), leaf_key.cend(), key.cbegin(), key.cend());
+    if (mismatch.second == key.cend()) return Upper ? node.end : node.begin;
+    if (mismatch.first == leaf_key.cend() || *mismatch.first < *mismatch.second) return std::nullopt;
+    return node.begin;
+  }
+
+  // If the key differs from the shared bytes of the subtree, all keys in the subtree are either smaller or greater
+  const auto& inner_node = static_cast<const ARTInnerNode&>(node);
+  for (const auto byte : inner_node.prefix) {
+    if (depth == key.size()) return Upper ? node.end : node.begin;
+    if (byte != key[depth]) {
+      if (byte > key[depth]) return node.begin;
+      return std::nullopt;
+    }
+    ++depth;
+  }
+  if (depth == key.size()) return Upper ? node.end : node.begin;
+
+  // Search the child for the key's byte. If all keys there are smaller, the result is the first row of the next child.
+  const auto byte = key[depth];
+  if (const auto* child = inner_node.child(byte)) {
+    const auto position = _search<Upper>(*child, key, depth + 1);
+    if (position) return position;
+  }
+  if (const auto* next_child = inner_node.next_child(byte)) return next_child->begin;
+  return std::nullopt;
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_iterator(const ChunkOffset position) const {
+  return Iterator{_offsets_block, _offsets.data() + position};
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+struct ARTNode;
+
+/**
+ * Adaptive radix tree (ART) index on one or more ValueSegments or DictionarySegments of any data type.
+ *
+ * Values are converted into binary-comparable keys, i.e., byte strings whose lexicographic order (comparing the bytes
+ * as unsigned integers) is the order of the values:
+ *  - integers are stored big-endian with their sign bit flipped, so that negative values come first,
+ *  - floating-point numbers are stored like integers after flipping all bits of negative numbers (and only the sign
+ *    bit of positive ones), which orders their IEEE 754 representations by value,
+ *  - strings are stored byte by byte and terminated by 0x00 0x00. A 0x00 byte within the string is stored as 0x00 0xFF,
+ *    so that no key is a prefix of another key.
+ *
+ * For composite indexes on several segments, the key of a row is the concatenation of the keys of its values, which
+ * orders the rows by the first segment, then by the second one, and so on. Lookups with values for only the first
+ * segments find all rows that start with these values, so that, e.g., lower_bound({a, b, x}) and upper_bound({a, b, y})
+ * return the rows with the values a and b in the first two segments and values between x and y in the third one.
+ *
+ * The tree branches on one byte of the key per level. Instead of one fixed fan-out of 256, nodes adapt to the number
+ * of their children (4, 16, 48, or 256), and bytes that all keys of a subtree share are stored once in the root of the
+ * subtree (path compression). A lookup therefore visits at most one node per key byte, independent of the number of
+ * rows, and cheaply compares bytes instead of values.
+ *
+ * As in the GroupKeyIndex, the chunk offsets are stored in one array, sorted by their values (and then by offset).
+ * Each node knows the range of this array that its subtree covers, so that lower_bound and upper_bound only descend
+ * along the searched key. prefix_range returns all rows whose string value starts with a given prefix.
+ */
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments);
+  ~AdaptiveRadixTreeIndex() override;
+
+  // returns the positions of all rows whose values start with prefix. Only supported for a single string segment.
+  std::pair<Iterator, Iterator> prefix_range(const std::string& prefix) const;
+
+ protected:
+  Iterator _on_lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_cbegin() const override;
+  Iterator _on_cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _on_get_indexed_segments() const override;
+
+  // Builds the subtree for the distinct keys [begin, end), which share their first depth bytes. The rows with
+  // keys[index] are stored in _offsets from key_starts[index] to key_starts[index + 1].
+  static std::unique_ptr<ARTNode> _build(std::vector<std::vector<uint8_t>>& keys,
+                                         const std::vector<ChunkOffset>& key_starts, const size_t begin,
+                                         const size_t end, const size_t depth);
+
+  // returns the concatenated keys of values
+  std::vector<uint8_t> _encode(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the position in _offsets of the first row whose key is not less than (or, if Upper is true, greater than)
+  // key, or nullopt if there is no such row in the subtree of node
+  template <bool Upper>
+  static std::optional<ChunkOffset> _search(const ARTNode& node, const std::vector<uint8_t>& key, size_t depth);
+
+  Iterator _iterator(const ChunkOffset position) const;
+
+  const std::vector<std::shared_ptr<const BaseSegment>> _indexed_segments;
+  bool _indexes_strings{false};
+
+  // for each indexed segment, appends the binary-comparable key of a value of its data type to a key
+  std::vector<std::function<void(const AllTypeVariant&, std::vector<uint8_t>&)>> _append_key_bytes;
+
+  std::vector<ChunkOffset> _offsets;
+
+  // the single block that _offsets consists of
+  OffsetBlock _offsets_block;
+
+  // nullptr if the segment is empty
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::child(const uint8_t byte) const {
+  for (auto index = size_t{0}; index < child_count; ++index) {
+    if (bytes[index] == byte) return children[index].get();
+  }
+  return nullptr;
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::next_child(const uint8_t byte) const {
+  for (auto index = size_t{0}; index < child_count; ++index) {
+    if (bytes[index] > byte) return children[index].get();
+  }
+  return nullptr;
+}
+
+template <size_t Capacity>
+void ARTSortedNode<Capacity>::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(child_count < Capacity, "Node is full.");
+  DebugAssert(child_count == 0 || bytes[child_count - 1] < byte, "Children have to be added in ascending order.");
+  bytes[child_count] = byte;
+  children[child_count] = std::move(child);
+  ++child_count;
+}
+
+template struct ARTSortedNode<4>;
+template struct ARTSortedNode<16>;
+
+const ARTNode* ARTNode48::child(const uint8_t byte) const {
+  const auto slot = child_slots[byte];
+  return slot == EMPTY_SLOT ? nullptr : children[slot].get();
+}
+
+const ARTNode* ARTNode48::next_child(const uint8_t byte) const {
+  for (auto next_byte = size_t{byte} + 1; next_byte < child_slots.size(); ++next_byte) {
+    const auto slot = child_slots[next_byte];
+    if (slot != EMPTY_SLOT) return children[slot].get();
+  }
+  return nullptr;
+}
+
+void ARTNode48::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(child_count < children.size(), "Node is full.");
+  child_slots[byte] = static_cast<uint8_t>(child_count);
+  children[child_count] = std::move(child);
+  ++child_count;
+}
+
+std::array<uint8_t, 256> ARTNode48::_empty_slots() {
+  auto slots = std::array<uint8_t, 256>{};
+  slots.fill(EMPTY_SLOT);
+  return slots;
+}
+
+const ARTNode* ARTNode256::child(const uint8_t byte) const { return children[byte].get(); }
+
+const ARTNode* ARTNode256::next_child(const uint8_t byte) const {
+  for (auto next_byte = size_t{byte} + 1; next_byte < children.size(); ++next_byte) {
+    if (children[next_byte]) return children[next_byte].get();
+  }
+  return nullptr;
+}
+
+void ARTNode256::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) { children[byte] = std::move(child); }
+
+}  // namespace opossum
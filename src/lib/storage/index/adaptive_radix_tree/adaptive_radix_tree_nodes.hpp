@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Nodes of the AdaptiveRadixTreeIndex. Every node covers a range [begin, end) of the index's chunk offsets, which are
+ * sorted by key, so the offsets of a whole subtree can be returned without visiting it.
+ *
+ * Inner nodes store the bytes that all keys in their subtree share after the bytes of the path to the node (path
+ * compression), and one child per distinct next byte. To keep nodes small, there are four node types of increasing
+ * capacity: up to 4 and 16 children are stored in sorted arrays, up to 48 children via an array of 256 child indexes,
+ * and more children directly in an array of 256 children.
+ */
+struct ARTNode : private Noncopyable {
+  ARTNode(const ChunkOffset init_begin, const ChunkOffset init_end) : begin(init_begin), end(init_end) {}
+  virtual ~ARTNode() = default;
+
+  virtual bool is_leaf() const = 0;
+
+  const ChunkOffset begin;
+  const ChunkOffset end;
+};
+
+// A distinct key of the index, stored completely, as the path to the leaf only contains the bytes up to the point
+// where the key differs from all other keys
+struct ARTLeaf : public ARTNode {
+  ARTLeaf(const ChunkOffset init_begin, const ChunkOffset init_end, std::vector<uint8_t>&& init_key)
+      : ARTNode(init_begin, init_end), key(std::move(init_key)) {}
+
+  bool is_leaf() const override { return true; }
+
+  const std::vector<uint8_t> key;
+};
+
+struct ARTInnerNode : public ARTNode {
+  ARTInnerNode(const ChunkOffset init_begin, const ChunkOffset init_end, std::vector<uint8_t>&& init_prefix)
+      : ARTNode(init_begin, init_end), prefix(std::move(init_prefix)) {}
+
+  bool is_leaf() const override { return false; }
+
+  // returns the child for byte, or nullptr
+  virtual const ARTNode* child(const uint8_t byte) const = 0;
+
+  // returns the child with the smallest byte greater than byte, or nullptr
+  virtual const ARTNode* next_child(const uint8_t byte) const = 0;
+
+  // Children have to be added in ascending order of their bytes. The node takes ownership of child.
+  virtual void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) = 0;
+
+  const std::vector<uint8_t> prefix;
+};
+
+// Node4 and Node16
+template <size_t Capacity>
+struct ARTSortedNode : public ARTInnerNode {
+  using ARTInnerNode::ARTInnerNode;
+
+  const ARTNode* child(const uint8_t byte) const override;
+  const ARTNode* next_child(const uint8_t byte) const override;
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) override;
+
+  size_t child_count{0};
+  std::array<uint8_t, Capacity> bytes{};
+  std::array<std::unique_ptr<ARTNode>, Capacity> children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+struct ARTNode48 : public ARTInnerNode {
+  using ARTInnerNode::ARTInnerNode;
+
+  static constexpr auto EMPTY_SLOT = uint8_t{255};
+
+  const ARTNode* child(const uint8_t byte) const override;
+  const ARTNode* next_child(const uint8_t byte) const override;
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) override;
+
+  size_t child_count{0};
+
+  // the slot in children for each byte, or EMPTY_SLOT
+  std::array<uint8_t, 256> child_slots = _empty_slots();
+  std::array<std::unique_ptr<ARTNode>, 48> children;
+
+ private:
+  static std::array<uint8_t, 256> _empty_slots();
+};
+
+struct ARTNode256 : public ARTInnerNode {
+  using ARTInnerNode::ARTInnerNode;
+
+  const ARTNode* child(const uint8_t byte) const override;
+  const ARTNode* next_child(const uint8_t byte) const override;
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) override;
+
+  std::array<std::unique_ptr<ARTNode>, 256> children;
+};
+
+}  // namespace opossum
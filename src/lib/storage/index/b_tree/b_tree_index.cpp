@@ -0,0 +1,50 @@
+#include "b_tree_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "b_tree_index_impl.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BTreeIndex::BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments)
+    : _indexed_segment(segments.size() == 1 ? segments.front() : nullptr) {
+  Assert(_indexed_segment != nullptr, "BTreeIndex only indexes a single segment.");
+
+  hana::for_each(data_types, [&](auto type_pair) {
+    using DataType = typename decltype(+hana::second(type_pair))::type;
+    if (std::dynamic_pointer_cast<const ValueSegment<DataType>>(_indexed_segment) ||
+        std::dynamic_pointer_cast<const DictionarySegment<DataType>>(_indexed_segment)) {
+      _impl = std::make_unique<BTreeIndexImpl<DataType>>(_indexed_segment);
+    }
+  });
+  Assert(static_cast<bool>(_impl), "BTreeIndex requires a ValueSegment or DictionarySegment.");
+}
+
+BTreeIndex::~BTreeIndex() = default;
+
+BaseIndex::Iterator BTreeIndex::_on_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->lower_bound(values.front());
+}
+
+BaseIndex::Iterator BTreeIndex::_on_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->upper_bound(values.front());
+}
+
+BaseIndex::Iterator BTreeIndex::_on_cbegin() const { return _impl->cbegin(); }
+
+BaseIndex::Iterator BTreeIndex::_on_cend() const { return _impl->cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> BTreeIndex::_on_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+bool BTreeIndex::_on_supports_append() const { return _impl->supports_insert(); }
+
+void BTreeIndex::_on_append(const ChunkOffset chunk_offset) { _impl->insert(chunk_offset); }
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseBTreeIndexImpl;
+class BaseSegment;
+
+/**
+ * B+-tree index on a single ValueSegment or DictionarySegment. Unlike the GroupKeyIndex, it can be created for the
+ * chunk that Table::append currently writes into: rows appended to the chunk are inserted into the tree.
+ *
+ * The index is built bottom-up from the sorted values of the segment. Leaves store up to NODE_CAPACITY keys together
+ * with the chunk offsets of their rows. The offsets of each leaf form one OffsetBlock, and the blocks are linked in
+ * key order, so iterating the index walks along the leaves. Rows with equal values are ordered by their offsets. The
+ * nodes are large so that a lookup only touches a few of them, and the search within a node is a branch-free count
+ * of the keys that are smaller than the searched one, which the compiler vectorizes for numeric keys.
+ */
+class BTreeIndex : public BaseIndex {
+ public:
+  explicit BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments);
+  ~BTreeIndex() override;
+
+ protected:
+  Iterator _on_lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_cbegin() const override;
+  Iterator _on_cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _on_get_indexed_segments() const override;
+  bool _on_supports_append() const override;
+  void _on_append(const ChunkOffset chunk_offset) override;
+
+  const std::shared_ptr<const BaseSegment> _indexed_segment;
+  std::unique_ptr<BaseBTreeIndexImpl> _impl;
+};
+
+}  // namespace opossum
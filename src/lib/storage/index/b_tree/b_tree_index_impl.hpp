@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Untyped interface of the BTreeIndexImpl, which BTreeIndex forwards to
+class BaseBTreeIndexImpl : private Noncopyable {
+ public:
+  virtual ~BaseBTreeIndexImpl() = default;
+
+  virtual BaseIndex::Iterator lower_bound(const AllTypeVariant& value) const = 0;
+  virtual BaseIndex::Iterator upper_bound(const AllTypeVariant& value) const = 0;
+  virtual BaseIndex::Iterator cbegin() const = 0;
+  virtual BaseIndex::Iterator cend() const = 0;
+
+  // returns true if the indexed segment is a ValueSegment, i.e., rows can be appended to it
+  virtual bool supports_insert() const = 0;
+
+  // inserts the row at chunk_offset, which was appended to the indexed segment
+  virtual void insert(const ChunkOffset chunk_offset) = 0;
+};
+
+template <typename T>
+class BTreeIndexImpl : public BaseBTreeIndexImpl {
+ public:
+  // maximum number of keys per node. Inner nodes have up to one more child than keys.
+  static constexpr auto NODE_CAPACITY = size_t{64};
+
+  explicit BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segment) : _segment(segment) {
+    // Sort the rows by their values. The stable sort keeps rows with equal values ordered by their offsets.
+    auto entries = std::vector<std::pair<T, ChunkOffset>>{};
+    entries.reserve(segment->size());
+    segment_iterate<T>(*segment, [&](const auto& position) {
+      entries.emplace_back(position.value(), position.chunk_offset());
+    });
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    _bulk_load(entries);
+  }
+
+  BaseIndex::Iterator lower_bound(const AllTypeVariant& value) const override {
+    return _find<false>(type_cast<T>(value));
+  }
+
+  BaseIndex::Iterator upper_bound(const AllTypeVariant& value) const override {
+    return _find<true>(type_cast<T>(value));
+  }
+
+  BaseIndex::Iterator cbegin() const override {
+    return BaseIndex::Iterator{_first_leaf->block, _first_leaf->block.begin};
+  }
+
+  BaseIndex::Iterator cend() const override { return BaseIndex::Iterator{_last_leaf->block, _last_leaf->block.end}; }
+
+  bool supports_insert() const override { return dynamic_cast<const ValueSegment<T>*>(_segment.get()) != nullptr; }
+
+  void insert(const ChunkOffset chunk_offset) override {
+    const auto value_segment = dynamic_cast<const ValueSegment<T>*>(_segment.get());
+    Assert(value_segment, "Only indexes on ValueSegments can be updated.");
+    DebugAssert(chunk_offset < value_segment->size(), "Row was not appended to the indexed segment.");
+
+    const auto split = _insert(*_root, value_segment->values()[chunk_offset], chunk_offset);
+    if (split) {
+      // The root was split, so the tree grows by one level
+      auto& root = _create_inner_node();
+      root.size = 1;
+      root.keys[0] = split->first;
+      root.children[0] = _root;
+      root.children[1] = split->second;
+      _root = &root;
+    }
+  }
+
+ protected:
+  struct Node {
+    explicit Node(const bool init_is_leaf) : is_leaf(init_is_leaf) {}
+
+    const bool is_leaf;
+
+    // number of keys
+    size_t size{0};
+    std::array<T, NODE_CAPACITY> keys;
+  };
+
+  struct Leaf : public Node {
+    Leaf() : Node(true) {}
+
+    std::array<ChunkOffset, NODE_CAPACITY> offsets;
+
+    // refers to offsets and to the block of the next leaf
+    BaseIndex::OffsetBlock block{offsets.data(), offsets.data(), nullptr};
+  };
+
+  struct InnerNode : public Node {
+    InnerNode() : Node(false) {}
+
+    // All keys in children[i] are not greater than keys[i], which is not greater than all keys in children[i + 1]
+    std::array<Node*, NODE_CAPACITY + 1> children;
+  };
+
+  // A key and the new node to the right of it, which are to be inserted into the parent of a split node
+  using Split = std::optional<std::pair<T, Node*>>;
+
+  // Returns the number of keys in node that are less than key (or, if Upper is true, not greater than key), i.e., the
+  // position of key in node. Numeric keys are counted without branches over the whole node, which the compiler
+  // vectorizes. As nodes are small, this is faster than a binary search with its unpredictable branches.
+  template <bool Upper>
+  static size_t _search(const Node& node, const T& key) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      auto count = size_t{0};
+      for (auto index = size_t{0}; index < node.size; ++index) {
+        if constexpr (Upper) {
+          count += node.keys[index] <= key;
+        } else {
+          count += node.keys[index] < key;
+        }
+      }
+      return count;
+    } else {
+      const auto end = node.keys.cbegin() + node.size;
+      if constexpr (Upper) {
+        return std::distance(node.keys.cbegin(), std::upper_bound(node.keys.cbegin(), end, key));
+      } else {
+        return std::distance(node.keys.cbegin(), std::lower_bound(node.keys.cbegin(), end, key));
+      }
+    }
+  }
+
+  template <bool Upper>
+  BaseIndex::Iterator _find(const T& key) const {
+    const Node* node = _root;
+    while (!node->is_leaf) {
+      node = static_cast<const InnerNode*>(node)->children[_search<Upper>(*node, key)];
+    }
+    const auto& leaf = static_cast<const Leaf&>(*node);
+    return BaseIndex::Iterator{leaf.block, leaf.offsets.data() + _search<Upper>(leaf, key)};
+  }
+
+  // Builds the tree from entries that are sorted by their keys. All nodes are filled completely.
+  void _bulk_load(const std::vector<std::pair<T, ChunkOffset>>& entries) {
+    auto level = std::vector<Node*>{};
+    auto previous_leaf = static_cast<Leaf*>(nullptr);
+    for (auto begin = size_t{0}; begin < entries.size() || level.empty(); begin += NODE_CAPACITY) {
+      auto& leaf = _create_leaf();
+      leaf.size = std::min(NODE_CAPACITY, entries.size() - begin);
+      for (auto index = size_t{0}; index < leaf.size; ++index) {
+        leaf.keys[index] = entries[begin + index].first;
+        leaf.offsets[index] = entries[begin + index].second;
+      }
+      _update_block(leaf);
+
+      if (previous_leaf) {
+        previous_leaf->block.next = &leaf.block;
+      } else {
+        _first_leaf = &leaf;
+      }
+      previous_leaf = &leaf;
+      level.emplace_back(&leaf);
+    }
+    _last_leaf = previous_leaf;
+
+    // Build the levels of inner nodes until there is only the root left. The key in front of each child (except for
+    // the first one) is the smallest key of that child.
+    while (level.size() > 1) {
+      auto next_level = std::vector<Node*>{};
+      for (auto begin = size_t{0}; begin < level.size(); begin += NODE_CAPACITY + 1) {
+        auto& inner_node = _create_inner_node();
+        const auto child_count = std::min(NODE_CAPACITY + 1, level.size() - begin);
+        inner_node.size = child_count - 1;
+        for (auto index = size_t{0}; index < child_count; ++index) {
+          inner_node.children[index] = level[begin + index];
+          if (index > 0) inner_node.keys[index - 1] = _smallest_key(*level[begin + index]);
+        }
+        next_level.emplace_back(&inner_node);
+      }
+      level = std::move(next_level);
+    }
+    _root = level.front();
+  }
+
+  static const T& _smallest_key(const Node& node) {
+    const Node* current = &node;
+    while (!current->is_leaf) {
+      current = static_cast<const InnerNode*>(current)->children[0];
+    }
+    return current->keys[0];
+  }
+
+  // Inserts key into the subtree of node. If node had to be split, returns the new right node and its separator key.
+  Split _insert(Node& node, const T& key, const ChunkOffset chunk_offset) {
+    // Behind all equal keys, so that equal keys stay ordered by their offsets
+    const auto position = _search<true>(node, key);
+
+    if (node.is_leaf) {
+      auto& leaf = static_cast<Leaf&>(node);
+      if (leaf.size < NODE_CAPACITY) {
+        _insert_into_leaf(leaf, position, key, chunk_offset);
+        return std::nullopt;
+      }
+
+      // Move the upper half into a new leaf, which follows leaf in the chain of blocks
+      auto& right = _create_leaf();
+      const auto left_size = NODE_CAPACITY / 2;
+      right.size = NODE_CAPACITY - left_size;
+      std::move(leaf.keys.begin() + left_size, leaf.keys.end(), right.keys.begin());
+      std::copy(leaf.offsets.cbegin() + left_size, leaf.offsets.cend(), right.offsets.begin());
+      leaf.size = left_size;
+
+      right.block.next = leaf.block.next;
+      leaf.block.next = &right.block;
+      if (_last_leaf == &leaf) _last_leaf = &right;
+
+      if (position <= left_size) {
+        _insert_into_leaf(leaf, position, key, chunk_offset);
+        _update_block(right);
+      } else {
+        _update_block(leaf);
+        _insert_into_leaf(right, position - left_size, key, chunk_offset);
+      }
+      return std::make_pair(right.keys[0], &right);
+    }
+
+    auto& inner_node = static_cast<InnerNode&>(node);
+    const auto child_split = _insert(*inner_node.children[position], key, chunk_offset);
+    if (!child_split) return std::nullopt;
+
+    if (inner_node.size < NODE_CAPACITY) {
+      _insert_into_inner_node(inner_node, position, child_split->first, child_split->second);
+      return std::nullopt;
+    }
+
+    // Move the upper half into a new inner node. The key between both halves moves up into the parent.
+    auto& right = _create_inner_node();
+    const auto left_size = NODE_CAPACITY / 2;
+    auto separator = std::move(inner_node.keys[left_size]);
+    right.size = NODE_CAPACITY - left_size - 1;
+    std::move(inner_node.keys.begin() + left_size + 1, inner_node.keys.end(), right.keys.begin());
+    std::copy(inner_node.children.cbegin() + left_size + 1, inner_node.children.cend(), right.children.begin());
+    inner_node.size = left_size;
+
+    if (position <= left_size) {
+      _insert_into_inner_node(inner_node, position, child_split->first, child_split->second);
+    } else {
+      _insert_into_inner_node(right, position - left_size - 1, child_split->first, child_split->second);
+    }
+    return std::make_pair(std::move(separator), &right);
+  }
+
+  static void _insert_into_leaf(Leaf& leaf, const size_t position, const T& key, const ChunkOffset chunk_offset) {
+    std::move_backward(leaf.keys.begin() + position, leaf.keys.begin() + leaf.size, leaf.keys.begin() + leaf.size + 1);
+    std::copy_backward(leaf.offsets.cbegin() + position, leaf.offsets.cbegin() + leaf.size,
+                       leaf.offsets.begin() + leaf.size + 1);
+    leaf.keys[position] = key;
+    leaf.offsets[position] = chunk_offset;
+    ++leaf.size;
+    _update_block(leaf);
+  }
+
+  // inserts key at position and child behind it
+  static void _insert_into_inner_node(InnerNode& inner_node, const size_t position, const T& key, Node* child) {
+    std::move_backward(inner_node.keys.begin() + position, inner_node.keys.begin() + inner_node.size,
+                       inner_node.keys.begin() + inner_node.size + 1);
+    std::copy_backward(inner_node.children.cbegin() + position + 1, inner_node.children.cbegin() + inner_node.size + 1,
+                       inner_node.children.begin() + inner_node.size + 2);
+    inner_node.keys[position] = key;
+    inner_node.children[position + 1] = child;
+    ++inner_node.size;
+  }
+
+  static void _update_block(Leaf& leaf) { leaf.block.end = leaf.offsets.data() + leaf.size; }
+
+  Leaf& _create_leaf() { return *_leaves.emplace_back(std::make_unique<Leaf>()); }
+
+  InnerNode& _create_inner_node() { return *_inner_nodes.emplace_back(std::make_unique<InnerNode>()); }
+
+  const std::shared_ptr<const BaseSegment> _segment;
+
+  std::vector<std::unique_ptr<Leaf>> _leaves;
+  std::vector<std::unique_ptr<InnerNode>> _inner_nodes;
+
+  Node* _root{nullptr};
+  Leaf* _first_leaf{nullptr};
+  Leaf* _last_leaf{nullptr};
+};
+
+}  // namespace opossum
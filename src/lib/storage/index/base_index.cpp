@@ -0,0 +1,43 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  return _on_get_indexed_segments() == segments;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _on_get_indexed_segments().size(),
+              "Expected between one value and one value per indexed segment.");
+  return _on_lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _on_get_indexed_segments().size(),
+              "Expected between one value and one value per indexed segment.");
+  return _on_upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _on_cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _on_cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> BaseIndex::get_indexed_segments() const {
+  return _on_get_indexed_segments();
+}
+
+bool BaseIndex::supports_append() const { return _on_supports_append(); }
+
+void BaseIndex::on_append(const ChunkOffset chunk_offset) { _on_append(chunk_offset); }
+
+bool BaseIndex::_on_supports_append() const { return false; }
+
+void BaseIndex::_on_append(const ChunkOffset) { Fail("Index does not support appending rows."); }
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * BaseIndex is the abstract super class of all indexes on the segments of a chunk. An index is created for one or more
+ * segments of the same chunk (see Chunk::create_index) and maps values to the offsets of the rows in that chunk.
+ *
+ * Conceptually, an index is a list of all chunk offsets of the chunk, sorted by the values of the indexed segments.
+ * lower_bound and upper_bound return positions in this list, so that [lower_bound(v), upper_bound(v)) are the offsets
+ * of all rows with the values v, and [cbegin(), lower_bound(v)) are the offsets of all rows with smaller values. For
+ * multi-column indexes, fewer values than indexed segments can be passed, which finds all rows that match this prefix.
+ *
+ * The list does not have to be stored in one array. It consists of one or more OffsetBlocks, i.e., contiguous arrays of
+ * chunk offsets that are linked to their successors. Indexes that store all offsets in one array (e.g., the
+ * GroupKeyIndex) use a single block, the BTreeIndex uses one block per leaf. Iterators move through the offsets of a
+ * block using a pointer and only follow the link at the end of a block.
+ *
+ * The public methods check their arguments and forward to the protected _on_* methods, which are implemented by the
+ * concrete index types. Chunk::append calls on_append for all indexes of the chunk, which is only supported by
+ * indexes on mutable segments. It checks supports_append for all indexes before modifying any segment.
+ */
+class BaseIndex : private Noncopyable {
+ public:
+  struct OffsetBlock {
+    const ChunkOffset* begin{nullptr};
+    const ChunkOffset* end{nullptr};
+    const OffsetBlock* next{nullptr};
+  };
+
+  class Iterator : public boost::iterator_facade<Iterator, const ChunkOffset, boost::forward_traversal_tag> {
+   public:
+    Iterator() = default;
+
+    // Points to position within block. If position is the end of a block that has a successor, the iterator is moved
+    // to the beginning of the successor, so that equal positions in the list are represented by equal iterators.
+    Iterator(const OffsetBlock& block, const ChunkOffset* position) : _block{&block}, _position{position} {
+      _skip_block_ends();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() {
+      ++_position;
+      _skip_block_ends();
+    }
+
+    bool equal(const Iterator& other) const { return _position == other._position; }
+
+    const ChunkOffset& dereference() const { return *_position; }
+
+    void _skip_block_ends() {
+      while (_position == _block->end && _block->next) {
+        _block = _block->next;
+        _position = _block->begin;
+      }
+    }
+
+    const OffsetBlock* _block{nullptr};
+    const ChunkOffset* _position{nullptr};
+  };
+
+  BaseIndex() = default;
+  virtual ~BaseIndex() = default;
+
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns true if the index indexes exactly the given segments, in the given order
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
+
+  // returns the position of the first row whose values are not less than values
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the position of the first row whose values are greater than values
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the positions of all rows, sorted by their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  std::vector<std::shared_ptr<const BaseSegment>> get_indexed_segments() const;
+
+  // returns true if rows appended to the indexed segments can be added to the index using on_append
+  bool supports_append() const;
+
+  // adds the row at chunk_offset, which was just appended to the indexed segments, to the index
+  void on_append(const ChunkOffset chunk_offset);
+
+ protected:
+  virtual Iterator _on_lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _on_upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _on_cbegin() const = 0;
+  virtual Iterator _on_cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseSegment>> _on_get_indexed_segments() const = 0;
+
+  // do not support appends by default, as most indexes cannot be updated
+  virtual bool _on_supports_append() const;
+  virtual void _on_append(const ChunkOffset chunk_offset);
+};
+
+}  // namespace opossum
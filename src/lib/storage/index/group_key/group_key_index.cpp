@@ -0,0 +1,74 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments)
+    : _indexed_segment(segments.size() == 1 ? segments.front() : nullptr) {
+  Assert(_indexed_segment != nullptr, "GroupKeyIndex only indexes a single segment.");
+
+  hana::for_each(data_types, [&](auto type_pair) {
+    using DataType = typename decltype(+hana::second(type_pair))::type;
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<DataType>>(_indexed_segment);
+    if (!dictionary_segment) return;
+
+    _lower_bound_value_id = [dictionary_segment](const AllTypeVariant& value) {
+      return dictionary_segment->lower_bound(value);
+    };
+    _upper_bound_value_id = [dictionary_segment](const AllTypeVariant& value) {
+      return dictionary_segment->upper_bound(value);
+    };
+
+    resolve_fitted_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      // Count the rows per value id. The counts are shifted by one, so that the prefix sums are the start offsets.
+      _value_start_offsets.resize(dictionary_segment->unique_values_count() + 1, 0);
+      for (const auto value_id : value_ids) {
+        ++_value_start_offsets[value_id + 1];
+      }
+      for (auto value_id = size_t{1}; value_id < _value_start_offsets.size(); ++value_id) {
+        _value_start_offsets[value_id] += _value_start_offsets[value_id - 1];
+      }
+
+      // Scatter the offsets into their groups, using a copy of the start offsets as write cursors
+      auto write_offsets = _value_start_offsets;
+      _postings.resize(value_ids.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+        _postings[write_offsets[value_ids[chunk_offset]]++] = chunk_offset;
+      }
+    });
+  });
+
+  Assert(static_cast<bool>(_lower_bound_value_id), "GroupKeyIndex requires a DictionarySegment.");
+  _postings_block = OffsetBlock{_postings.data(), _postings.data() + _postings.size(), nullptr};
+}
+
+BaseIndex::Iterator GroupKeyIndex::_on_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_lower_bound_value_id(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_on_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_upper_bound_value_id(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_on_cbegin() const { return Iterator{_postings_block, _postings_block.begin}; }
+
+BaseIndex::Iterator GroupKeyIndex::_on_cend() const { return Iterator{_postings_block, _postings_block.end}; }
+
+std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_on_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+BaseIndex::Iterator GroupKeyIndex::_postings_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _on_cend();
+  return Iterator{_postings_block, _postings_block.begin + _value_start_offsets[value_id]};
+}
+
+}  // namespace opossum
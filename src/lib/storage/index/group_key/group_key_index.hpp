@@ -0,0 +1,52 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Index on a single DictionarySegment. As the dictionary is sorted, the value ids already order the values, so the
+ * index only needs to list the chunk offsets grouped by value id: the postings hold the offsets of all rows with value
+ * id 0, followed by those with value id 1, and so on, each group in ascending order. For each value id, the index
+ * stores the position at which its group starts in the postings (plus one entry for the end of the last group).
+ *
+ * A lookup is a binary search in the dictionary followed by one access to these positions. The offsets of all
+ * matching rows are then read without looking at any other row, so point lookups cost O(log(distinct values) +
+ * matches). The index is built in two passes over the attribute vector (counting sort).
+ */
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments);
+
+ protected:
+  Iterator _on_lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _on_cbegin() const override;
+  Iterator _on_cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _on_get_indexed_segments() const override;
+
+  // returns the position in the postings at which the group of value_id starts. INVALID_VALUE_ID is mapped to the end.
+  Iterator _postings_begin(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseSegment> _indexed_segment;
+
+  // lower_bound and upper_bound of the typed DictionarySegment
+  std::function<ValueID(const AllTypeVariant&)> _lower_bound_value_id;
+  std::function<ValueID(const AllTypeVariant&)> _upper_bound_value_id;
+
+  // _value_start_offsets[value_id] is the position of the first offset with value_id in _postings
+  std::vector<ChunkOffset> _value_start_offsets;
+  std::vector<ChunkOffset> _postings;
+
+  // the single block that _postings consists of
+  OffsetBlock _postings_block;
+};
+
+}  // namespace opossum
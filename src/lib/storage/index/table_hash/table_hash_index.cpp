@@ -0,0 +1,41 @@
+#include "table_hash_index.hpp"
+
+#include <memory>
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+template <typename T>
+PosList TableHashIndex<T>::lookup(const AllTypeVariant& value) const {
+  const auto range = _row_ids.equal_range(type_cast<T>(value));
+
+  auto pos_list = PosList{};
+  for (auto it = range.first; it != range.second; ++it) {
+    pos_list.emplace_back(it->second);
+  }
+  return pos_list;
+}
+
+template <typename T>
+void TableHashIndex<T>::insert(const AllTypeVariant& value, const RowID& row_id) {
+  _row_ids.emplace(type_cast<T>(value), row_id);
+}
+
+template <typename T>
+void TableHashIndex<T>::insert_segment(const BaseSegment& segment, const ChunkID chunk_id) {
+  _row_ids.reserve(_row_ids.size() + segment.size());
+  segment_iterate<T>(segment, [&](const auto& position) {
+    _row_ids.emplace(position.value(), RowID{chunk_id, position.chunk_offset()});
+  });
+}
+
+template <typename T>
+size_t TableHashIndex<T>::size() const {
+  return _row_ids.size();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableHashIndex);
+
+}  // namespace opossum
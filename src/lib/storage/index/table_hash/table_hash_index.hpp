@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * Untyped interface of the TableHashIndex. Unlike the indexes derived from BaseIndex, which index the segments of a
+ * single chunk, a table hash index covers a column of all chunks of a table and maps values directly to RowIDs. A
+ * point lookup thus costs one hash table probe, independent of the number of chunks, instead of one lookup per chunk.
+ *
+ * It is created and maintained by the Table (see Table::create_hash_index).
+ */
+class BaseTableHashIndex : private Noncopyable {
+ public:
+  virtual ~BaseTableHashIndex() = default;
+
+  // returns the positions of all rows with value, in no particular order
+  virtual PosList lookup(const AllTypeVariant& value) const = 0;
+
+  // adds the row at row_id, whose value in the indexed column is value
+  virtual void insert(const AllTypeVariant& value, const RowID& row_id) = 0;
+
+  // adds all rows of segment, which is the indexed segment of the chunk chunk_id
+  virtual void insert_segment(const BaseSegment& segment, const ChunkID chunk_id) = 0;
+
+  // returns the number of indexed rows
+  virtual size_t size() const = 0;
+};
+
+template <typename T>
+class TableHashIndex : public BaseTableHashIndex {
+ public:
+  PosList lookup(const AllTypeVariant& value) const override;
+  void insert(const AllTypeVariant& value, const RowID& row_id) override;
+  void insert_segment(const BaseSegment& segment, const ChunkID chunk_id) override;
+  size_t size() const override;
+
+ protected:
+  std::unordered_multimap<T, RowID> _row_ids;
+};
+
+}  // namespace opossum
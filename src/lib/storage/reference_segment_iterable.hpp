@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "base_segment_iterable.hpp"
+#include "dictionary_segment.hpp"
+#include "dictionary_segment_iterable.hpp"
+#include "reference_segment.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "value_segment.hpp"
+#include "value_segment_iterable.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over a ReferenceSegment by gathering the referenced values from the segments of the referenced table.
+ *
+ * If the position list guarantees that it references a single chunk, the referenced segment is resolved once and its
+ * point access iterators are used. Otherwise, instead of calling Table::get_chunk and resolving the type of the
+ * referenced segment for every position, the gathering iterator caches the segment of the chunk it accessed last.
+ * Position lists produced by our operators are grouped by chunk, so the referenced segment is resolved roughly once
+ * per referenced chunk.
+ */
+template <typename T>
+class ReferenceSegmentIterable : public BaseSegmentIterable<ReferenceSegmentIterable<T>> {
+ public:
+  explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& table = *_segment.referenced_table();
+    const auto column_id = _segment.referenced_column_id();
+    const auto& pos_list = *_segment.pos_list();
+
+    if (!pos_list.empty() && pos_list.references_single_chunk()) {
+      const auto referenced_segment = table.get_chunk(pos_list.common_chunk_id()).get_segment(column_id);
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(referenced_segment)) {
+        ValueSegmentIterable<T>{*value_segment}.with_iterators(pos_list, functor);
+        return;
+      }
+      if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(referenced_segment)) {
+        DictionarySegmentIterable<T>{*dictionary_segment}.with_iterators(pos_list, functor);
+        return;
+      }
+      throw std::logic_error("ReferenceSegment must reference a ValueSegment or DictionarySegment of same type.");
+    }
+
+    functor(Iterator{table, column_id, pos_list, 0u},
+            Iterator{table, column_id, pos_list, static_cast<ChunkOffset>(pos_list.size())});
+  }
+
+  class Iterator : public BaseSegmentIterator<Iterator, T> {
+   public:
+    Iterator(const Table& table, const ColumnID column_id, const PosList& pos_list, const ChunkOffset chunk_offset)
+        : _table{&table}, _column_id{column_id}, _pos_list{&pos_list}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+    void decrement() { --_chunk_offset; }
+    void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto& row_id = (*_pos_list)[_chunk_offset];
+      if (!_cached_segment || row_id.chunk_id != _cached_chunk_id) {
+        _resolve_segment(row_id.chunk_id);
+      }
+
+      if (_cached_values) {
+        return {(*_cached_values)[row_id.chunk_offset], _chunk_offset};
+      }
+      const auto value_id = _cached_dictionary_segment->attribute_vector()->get(row_id.chunk_offset);
+      return {_cached_dictionary_segment->value_by_value_id(value_id), _chunk_offset};
+    }
+
+    void _resolve_segment(const ChunkID chunk_id) const {
+      _cached_chunk_id = chunk_id;
+      _cached_segment = _table->get_chunk(chunk_id).get_segment(_column_id);
+      _cached_values = nullptr;
+      _cached_dictionary_segment = nullptr;
+
+      if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(_cached_segment.get())) {
+        _cached_values = &value_segment->values();
+      } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(_cached_segment.get())) {
+        _cached_dictionary_segment = dictionary_segment;
+      } else {
+        throw std::logic_error("ReferenceSegment must reference a ValueSegment or DictionarySegment of same type.");
+      }
+    }
+
+    const Table* _table;
+    ColumnID _column_id;
+    const PosList* _pos_list;
+    ChunkOffset _chunk_offset;
+
+    // The segment is held as a shared_ptr so that it stays alive even if its chunk is replaced (e.g., by
+    // Table::compress_chunk) while we iterate.
+    mutable std::shared_ptr<const BaseSegment> _cached_segment;
+    mutable ChunkID _cached_chunk_id{0};
+    mutable const std::vector<T>* _cached_values{nullptr};
+    mutable const DictionarySegment<T>* _cached_dictionary_segment{nullptr};
+  };
+
+ protected:
+  const ReferenceSegment& _segment;
+};
+
+}  // namespace opossum
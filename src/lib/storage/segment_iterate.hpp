@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "base_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "dictionary_segment_iterable.hpp"
+#include "reference_segment.hpp"
+#include "reference_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+#include "value_segment_iterable.hpp"
+
+namespace opossum {
+
+/**
+ * This file is the entry point for operators that want to access the values of a segment without going through
+ * BaseSegment::operator[]. A segment is resolved only once (per chunk) to its concrete type, and from then on, all
+ * accesses are statically dispatched.
+ *
+ * Example:
+ *
+ *   resolve_data_type(table.column_type(column_id), [&](auto type) {
+ *     using ColumnDataType = typename decltype(type)::type;
+ *
+ *     segment_with_iterators<ColumnDataType>(*chunk.get_segment(column_id), [&](auto it, const auto end) {
+ *       for (; it != end; ++it) {
+ *         do_something(it->value(), it->chunk_offset());
+ *       }
+ *     });
+ *   });
+ */
+
+/**
+ * Resolves the concrete type of a segment and calls func with the segment cast to that type, i.e., with a
+ * const ValueSegment<T>&, a const DictionarySegment<T>& or a const ReferenceSegment&.
+ *
+ * Throws if the segment's type is not one of the above or does not match T.
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else {
+    throw std::logic_error("Unrecognized segment type or segment type does not match data type.");
+  }
+}
+
+template <typename T>
+ValueSegmentIterable<T> create_iterable_from_segment(const ValueSegment<T>& segment) {
+  return ValueSegmentIterable<T>{segment};
+}
+
+template <typename T>
+DictionarySegmentIterable<T> create_iterable_from_segment(const DictionarySegment<T>& segment) {
+  return DictionarySegmentIterable<T>{segment};
+}
+
+// The data type of a ReferenceSegment cannot be deduced from the segment, so it has to be passed explicitly
+template <typename T>
+ReferenceSegmentIterable<T> create_iterable_from_segment(const ReferenceSegment& segment) {
+  return ReferenceSegmentIterable<T>{segment};
+}
+
+/**
+ * Resolves the segment and calls functor(begin, end) with the concrete iterators of the segment.
+ */
+template <typename T, typename Functor>
+void segment_with_iterators(const BaseSegment& base_segment, const Functor& functor) {
+  resolve_segment_type<T>(base_segment, [&](const auto& segment) {
+    create_iterable_from_segment<T>(segment).with_iterators(functor);
+  });
+}
+
+/**
+ * Resolves the segment and calls functor(const SegmentPosition<T>&) for every value in the segment.
+ */
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& base_segment, const Functor& functor) {
+  resolve_segment_type<T>(base_segment, [&](const auto& segment) {
+    create_iterable_from_segment<T>(segment).for_each(functor);
+  });
+}
+
+/**
+ * Like segment_iterate, but only visits the offsets in [begin_offset, end_offset). This allows operators to split large
+ * chunks into smaller units of work (morsels).
+ */
+template <typename T, typename Functor>
+void segment_iterate_range(const BaseSegment& base_segment, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset, const Functor& functor) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= base_segment.size(), "Invalid range.");
+  segment_with_iterators<T>(base_segment, [&](auto it, const auto) {
+    const auto end = it + end_offset;
+    for (it += begin_offset; it != end; ++it) {
+      functor(*it);
+    }
+  });
+}
+
+}  // namespace opossum
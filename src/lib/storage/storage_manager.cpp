@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -23,12 +24,27 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
   if (!_tables.emplace(name, table).second) {
     throw std::runtime_error("The table " + name + " already exists.");
   }
+  _table_names.emplace(table.get(), name);
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  if (!_tables.erase(name)) {
+  const auto it = _tables.find(name);
+  if (it == _tables.cend()) {
     throw std::runtime_error("Table " + name + " not found.");
   }
+  const auto table = it->second;
+  _tables.erase(it);
+
+  // The table might still be held under another name
+  const auto name_it = _table_names.find(table.get());
+  if (name_it == _table_names.cend() || name_it->second != name) return;
+  _table_names.erase(name_it);
+  for (const auto& [other_name, other_table] : _tables) {
+    if (other_table == table) {
+      _table_names.emplace(table.get(), other_name);
+      break;
+    }
+  }
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
@@ -38,6 +54,12 @@ std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const
 
 bool StorageManager::has_table(const std::string& name) const { return _tables.find(name) != _tables.cend(); }
 
+std::optional<std::string> StorageManager::table_name(const Table& table) const {
+  const auto it = _table_names.find(&table);
+  if (it == _table_names.cend()) return std::nullopt;
+  return it->second;
+}
+
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> names;
   names.reserve(_tables.size());
@@ -53,6 +75,9 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
-void StorageManager::reset() { _tables.clear(); }
+void StorageManager::reset() {
+  _tables.clear();
+  _table_names.clear();
+}
 
 }  // namespace opossum
@@ -3,7 +3,9 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "types.hpp"
@@ -30,6 +32,10 @@ class StorageManager : private Noncopyable {
   // returns whether the storage manager holds a table with the given name
   bool has_table(const std::string& name) const;
 
+  // returns the name of the table instance, or nullopt if it is not held by the storage manager. If the table was
+  // added under several names, one of them is returned.
+  std::optional<std::string> table_name(const Table& table) const;
+
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
@@ -46,5 +52,8 @@ class StorageManager : private Noncopyable {
   StorageManager& operator=(StorageManager&&) = default;
 
   std::map<std::string, std::shared_ptr<Table>> _tables;
+
+  // the names of the table instances, so that operators can look them up without comparing all tables
+  std::unordered_map<const Table*, std::string> _table_names;
 };
 }  // namespace opossum
@@ -13,15 +13,19 @@
 #include <vector>
 
 #include "dictionary_segment.hpp"
+#include "index/table_hash/table_hash_index.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 Table::Table(const uint32_t chunk_size)
-    : _chunk_size{chunk_size}, _current_chunk{std::make_shared<Chunk>()}, _chunks{_current_chunk} {}
+    : _chunk_size{chunk_size}, _current_chunk{std::make_shared<Chunk>()}, _chunks{_current_chunk} {
+  _assign_chunk_node(ChunkID{0});
+}
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
   DebugAssert(_column_names.size() < std::numeric_limits<uint16_t>::max(), "Maximum amount of columns reached.");
@@ -44,6 +48,13 @@ void Table::append(std::vector<AllTypeVariant> values) {
   }
 
   _current_chunk->append(values);
+
+  if (!_hash_indexes.empty()) {
+    const auto row_id = RowID{static_cast<ChunkID>(_chunks.size() - 1), _current_chunk->size() - 1};
+    for (const auto& [column_id, hash_index] : _hash_indexes) {
+      hash_index->insert(values[column_id], row_id);
+    }
+  }
 }
 
 // creates a new chunk and sets it as current chunk;
@@ -54,6 +65,7 @@ void Table::create_new_chunk() {
     _current_chunk->add_segment(segment);
   }
   _chunks.push_back(_current_chunk);
+  _assign_chunk_node(static_cast<ChunkID>(_chunks.size() - 1));
 }
 
 uint16_t Table::column_count() const { return static_cast<uint16_t>(_column_names.size()); }
@@ -89,6 +101,8 @@ const std::string& Table::column_type(ColumnID column_id) const {
   return _column_types[column_id];
 }
 
+const std::vector<std::string>& Table::column_types() const { return _column_types; }
+
 bool Table::_is_full(const Chunk& chunk) const { return chunk.size() == _chunk_size; }
 
 void Table::emplace_chunk(Chunk chunk) {
@@ -97,13 +111,18 @@ void Table::emplace_chunk(Chunk chunk) {
   if (row_count() == 0) {
     _current_chunk = std::make_shared<Chunk>(std::move(chunk));
     _chunks[0] = _current_chunk;
-    return;
+  } else {
+    // This is just a primitive verification
+    DebugAssert(chunk.column_count() == column_count(), "The chunk's columns must match to the columns of the table.");
+    _current_chunk = std::make_shared<Chunk>(std::move(chunk));
+    _chunks.push_back(_current_chunk);
   }
 
-  // This is just a primitive verification
-  DebugAssert(chunk.column_count() == column_count(), "The chunk's columns must match to the columns of the table.");
-  _current_chunk = std::make_shared<Chunk>(std::move(chunk));
-  _chunks.push_back(_current_chunk);
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  _assign_chunk_node(chunk_id);
+  for (const auto& [column_id, hash_index] : _hash_indexes) {
+    if (_current_chunk->size() > 0) hash_index->insert_segment(*_current_chunk->get_segment(column_id), chunk_id);
+  }
 }
 
 Chunk& Table::get_chunk(ChunkID chunk_id) {
@@ -128,10 +147,51 @@ void Table::compress_chunk(ChunkID chunk_id) {
         make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type(column_id), segment);
     compressed_chunk->add_segment(dictionary_segment);
   }
+  compressed_chunk->set_node_id(uncompressed_chunk.node_id());
 
-  // Replace uncompressed chunk with dictionary compressed chunk.
+  // Replace uncompressed chunk with dictionary compressed chunk. The rows keep their offsets, so the hash indexes do
+  // not have to be updated.
   std::lock_guard lock(_chunks_mutex);
   _chunks[chunk_id] = std::move(compressed_chunk);
 }
 
+std::shared_ptr<const BaseTableHashIndex> Table::create_hash_index(ColumnID column_id) {
+  DebugAssert(column_id < _column_types.size(), "Column id is out of bounds.");
+
+  auto& hash_index = _hash_indexes[column_id];
+  if (hash_index) return hash_index;
+
+  hash_index = make_shared_by_data_type<BaseTableHashIndex, TableHashIndex>(column_type(column_id));
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto& chunk = get_chunk(chunk_id);
+    if (chunk.size() > 0) hash_index->insert_segment(*chunk.get_segment(column_id), chunk_id);
+  }
+  return hash_index;
+}
+
+std::shared_ptr<const BaseTableHashIndex> Table::get_hash_index(ColumnID column_id) const {
+  const auto it = _hash_indexes.find(column_id);
+  return it == _hash_indexes.cend() ? nullptr : it->second;
+}
+
+void Table::remove_hash_index(ColumnID column_id) { _hash_indexes.erase(column_id); }
+
+void Table::set_chunk_node_affinity(ChunkNodeAffinity chunk_node_affinity) {
+  _chunk_node_affinity = std::move(chunk_node_affinity);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    get_chunk(chunk_id).set_node_id(ANY_NODE_ID);
+    _assign_chunk_node(chunk_id);
+  }
+}
+
+void Table::_assign_chunk_node(ChunkID chunk_id) {
+  auto& chunk = get_chunk(chunk_id);
+  if (chunk.node_id() != ANY_NODE_ID) return;
+
+  const auto node_id = _chunk_node_affinity ? _chunk_node_affinity(chunk_id)
+                                            : static_cast<NodeID>(chunk_id % Topology::get().node_count());
+  DebugAssert(node_id < Topology::get().node_count(), "Chunk assigned to a node that does not exist.");
+  chunk.set_node_id(node_id);
+}
+
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <shared_mutex>
 
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -18,11 +19,15 @@
 
 namespace opossum {
 
+class BaseTableHashIndex;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
 class Table : private Noncopyable {
  public:
+  // Returns the NUMA node (see Topology) that tasks working on the chunk with the given id should prefer
+  using ChunkNodeAffinity = std::function<NodeID(ChunkID)>;
+
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
@@ -60,6 +65,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // Returns a list of all column types.
+  const std::vector<std::string>& column_types() const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -89,6 +97,22 @@ class Table : private Noncopyable {
   // compresses a ValueSegment into a DictionarySegment
   void compress_chunk(ChunkID chunk_id);
 
+  // Creates a hash index that maps the values of column_id in all chunks to their RowIDs (see BaseTableHashIndex), or
+  // returns the existing one. The index is updated by append and emplace_chunk. compress_chunk keeps the RowIDs of
+  // all rows, so the index stays valid.
+  std::shared_ptr<const BaseTableHashIndex> create_hash_index(ColumnID column_id);
+
+  // returns the hash index on column_id, or nullptr
+  std::shared_ptr<const BaseTableHashIndex> get_hash_index(ColumnID column_id) const;
+
+  void remove_hash_index(ColumnID column_id);
+
+  // Sets the node affinity of the chunks that are added from now on and assigns all existing chunks again. By
+  // default, chunks are distributed round-robin over the nodes of the Topology. The node of a chunk is only a hint for
+  // the scheduler, which prefers the workers of that node for tasks that work on the chunk. The chunk's memory is not
+  // bound to the node.
+  void set_chunk_node_affinity(ChunkNodeAffinity chunk_node_affinity);
+
  protected:
   const uint32_t _chunk_size;
   std::shared_ptr<Chunk> _current_chunk;
@@ -96,8 +120,13 @@ class Table : private Noncopyable {
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
   mutable std::shared_mutex _chunks_mutex;
+  std::map<ColumnID, std::shared_ptr<BaseTableHashIndex>> _hash_indexes;
+  ChunkNodeAffinity _chunk_node_affinity;
 
   // returns true if the maximum number of rows in chunk has been reached.
   bool _is_full(const Chunk& chunk) const;
+
+  // assigns a node to the chunk with the given id, unless it already has one
+  void _assign_chunk_node(ChunkID chunk_id);
 };
 }  // namespace opossum
@@ -13,6 +13,11 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment that holds the given values, e.g., the results of an operator
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t offset) const override;
 
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "base_segment_iterable.hpp"
+#include "types.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegmentIterable : public BaseSegmentIterable<ValueSegmentIterable<T>> {
+ public:
+  explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& values = _segment.values();
+    functor(Iterator{values, 0u}, Iterator{values, static_cast<ChunkOffset>(values.size())});
+  }
+
+  // Accesses only the offsets given in position_filter, which all have to reference this segment. The chunk_offset of
+  // the returned positions is the index within position_filter.
+  template <typename Functor>
+  void _on_with_iterators(const PosList& position_filter, const Functor& functor) const {
+    const auto& values = _segment.values();
+    functor(PointAccessIterator{values, position_filter, 0u},
+            PointAccessIterator{values, position_filter, static_cast<ChunkOffset>(position_filter.size())});
+  }
+
+  // Iterates sequentially over the values vector of the segment
+  class Iterator : public BaseSegmentIterator<Iterator, T> {
+   public:
+    Iterator(const std::vector<T>& values, const ChunkOffset chunk_offset)
+        : _values{&values}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+    void decrement() { --_chunk_offset; }
+    void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const { return {(*_values)[_chunk_offset], _chunk_offset}; }
+
+    const std::vector<T>* _values;
+    ChunkOffset _chunk_offset;
+  };
+
+  class PointAccessIterator : public BaseSegmentIterator<PointAccessIterator, T> {
+   public:
+    PointAccessIterator(const std::vector<T>& values, const PosList& position_filter, const ChunkOffset chunk_offset)
+        : _values{&values}, _position_filter{&position_filter}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() { ++_chunk_offset; }
+    void decrement() { --_chunk_offset; }
+    void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+    bool equal(const PointAccessIterator& other) const { return _chunk_offset == other._chunk_offset; }
+    std::ptrdiff_t distance_to(const PointAccessIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      return {(*_values)[(*_position_filter)[_chunk_offset].chunk_offset], _chunk_offset};
+    }
+
+    const std::vector<T>* _values;
+    const PosList* _position_filter;
+    ChunkOffset _chunk_offset;
+  };
+
+ protected:
+  const ValueSegment<T>& _segment;
+};
+
+}  // namespace opossum
@@ -0,0 +1,213 @@
+#include "index_advisor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+IndexAdvisor& IndexAdvisor::get() {
+  static IndexAdvisor index_advisor;
+  return index_advisor;
+}
+
+void IndexAdvisor::record_predicate(const Table& table, const ColumnID column_id, const uint64_t input_row_count,
+                                    const double selectivity, const std::chrono::nanoseconds runtime) {
+  auto table_name = StorageManager::get().table_name(table);
+  if (!table_name) return;
+
+  std::lock_guard lock(_mutex);
+  auto& statistics = _predicate_statistics[TableColumn{*table_name, column_id}];
+  if (statistics.scan_count == 0) {
+    statistics.table_name = std::move(*table_name);
+    statistics.column_id = column_id;
+  }
+  ++statistics.scan_count;
+  statistics.runtime += runtime;
+
+  // With an index, the scan only reads the selected rows
+  if (selectivity <= TableScan::INDEX_SCAN_MAX_SELECTIVITY) {
+    ++statistics.selective_scan_count;
+    statistics.skippable_row_count += std::llround(static_cast<double>(input_row_count) * (1.0 - selectivity));
+  }
+}
+
+std::vector<ColumnPredicateStatistics> IndexAdvisor::predicate_statistics() const {
+  std::lock_guard lock(_mutex);
+  auto predicate_statistics = std::vector<ColumnPredicateStatistics>{};
+  for (const auto& entry : _predicate_statistics) {
+    predicate_statistics.emplace_back(entry.second);
+  }
+  return predicate_statistics;
+}
+
+std::vector<IndexRecommendation> IndexAdvisor::recommend(const size_t memory_budget) const {
+  auto benefits = std::map<TableColumn, double>{};
+  {
+    std::lock_guard lock(_mutex);
+    benefits = _current_benefits();
+  }
+
+  const auto& storage_manager = StorageManager::get();
+  auto candidates = std::vector<IndexRecommendation>{};
+  for (const auto& entry : benefits) {
+    const auto& table_name = entry.first.first;
+    const auto column_id = entry.first.second;
+    if (entry.second <= 0.0 || !storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (column_id >= table->column_count()) continue;
+    candidates.emplace_back(
+        IndexRecommendation{table_name, column_id, entry.second, _estimate_memory_usage(*table, column_id)});
+  }
+
+  // Greedily pick the columns with the highest benefit per byte that still fit into the budget
+  const auto benefit_per_byte = [](const IndexRecommendation& recommendation) {
+    return recommendation.benefit / static_cast<double>(std::max(recommendation.memory_usage, size_t{1}));
+  };
+  std::sort(candidates.begin(), candidates.end(),
+            [&](const auto& lhs, const auto& rhs) { return benefit_per_byte(lhs) > benefit_per_byte(rhs); });
+
+  auto recommendations = std::vector<IndexRecommendation>{};
+  auto remaining_budget = memory_budget;
+  for (const auto& candidate : candidates) {
+    if (candidate.memory_usage > remaining_budget) continue;
+    remaining_budget -= candidate.memory_usage;
+    recommendations.emplace_back(candidate);
+  }
+  return recommendations;
+}
+
+std::vector<IndexRecommendation> IndexAdvisor::tune(const size_t memory_budget) {
+  const auto recommendations = recommend(memory_budget);
+
+  std::lock_guard lock(_mutex);
+
+  // Start a new tuning period. Columns whose benefit has decayed to almost nothing are forgotten.
+  _benefits = _current_benefits();
+  _predicate_statistics.clear();
+  for (auto it = _benefits.begin(); it != _benefits.end();) {
+    it = it->second < 1.0 ? _benefits.erase(it) : std::next(it);
+  }
+
+  const auto& storage_manager = StorageManager::get();
+  auto recommended_columns = std::set<TableColumn>{};
+  for (const auto& recommendation : recommendations) {
+    const auto table_column = TableColumn{recommendation.table_name, recommendation.column_id};
+    recommended_columns.emplace(table_column);
+    _create_indexes(table_column);
+  }
+
+  for (auto it = _created_indexes.begin(); it != _created_indexes.end();) {
+    const auto& table_name = it->first.first;
+    if (recommended_columns.count(it->first)) {
+      ++it;
+      continue;
+    }
+
+    if (storage_manager.has_table(table_name)) {
+      _drop_indexes(*storage_manager.get_table(table_name), it->first.second, it->second);
+    }
+    it = _created_indexes.erase(it);
+  }
+
+  return recommendations;
+}
+
+void IndexAdvisor::reset() {
+  std::lock_guard lock(_mutex);
+  _predicate_statistics.clear();
+  _benefits.clear();
+  _created_indexes.clear();
+}
+
+std::map<IndexAdvisor::TableColumn, double> IndexAdvisor::_current_benefits() const {
+  auto benefits = _benefits;
+  for (auto& entry : benefits) {
+    entry.second *= BENEFIT_DECAY;
+  }
+
+  for (const auto& entry : _predicate_statistics) {
+    if (entry.second.skippable_row_count == 0) continue;
+    benefits[entry.first] += static_cast<double>(entry.second.skippable_row_count);
+  }
+  return benefits;
+}
+
+size_t IndexAdvisor::_estimate_memory_usage(const Table& table, const ColumnID column_id) {
+  auto memory_usage = size_t{0};
+  resolve_data_type(table.column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+      if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+        // GroupKeyIndex: the postings and the start of each value's group in them
+        memory_usage += (segment->size() + dictionary_segment->unique_values_count() + 1) * sizeof(ChunkOffset);
+      } else {
+        // BTreeIndex: the keys and offsets in its leaves
+        memory_usage += segment->size() * (sizeof(ColumnDataType) + sizeof(ChunkOffset));
+      }
+    }
+  });
+  return memory_usage;
+}
+
+void IndexAdvisor::_create_indexes(const TableColumn& table_column) {
+  const auto table = StorageManager::get().get_table(table_column.first);
+  const auto column_id = table_column.second;
+  auto& created_indexes = _created_indexes[table_column];
+
+  resolve_data_type(table->column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Chunks that were replaced (e.g., by compress_chunk) lost their indexes and get new ones
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      auto& chunk = table->get_chunk(chunk_id);
+      if (chunk.size() == 0 || !chunk.get_indexes({column_id}).empty()) continue;
+
+      const auto segment = chunk.get_segment(column_id);
+      if (std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+        created_indexes.emplace_back(chunk.create_index<GroupKeyIndex>({column_id}));
+      } else if (std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        created_indexes.emplace_back(chunk.create_index<BTreeIndex>({column_id}));
+      }
+    }
+  });
+
+  created_indexes.erase(std::remove_if(created_indexes.begin(), created_indexes.end(),
+                                       [](const auto& index) { return index.expired(); }),
+                        created_indexes.end());
+}
+
+void IndexAdvisor::_drop_indexes(Table& table, const ColumnID column_id,
+                                 const std::vector<std::weak_ptr<BaseIndex>>& created_indexes) {
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    auto& chunk = table.get_chunk(chunk_id);
+    for (const auto& index : chunk.get_indexes({column_id})) {
+      const auto was_created = std::any_of(created_indexes.cbegin(), created_indexes.cend(),
+                                           [&](const auto& created_index) { return created_index.lock() == index; });
+      if (was_created) chunk.remove_index(index);
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseIndex;
+class Table;
+
+// the predicates that TableScans evaluated on a column of a table of the StorageManager, summed up per column
+struct ColumnPredicateStatistics {
+  std::string table_name;
+  ColumnID column_id;
+
+  uint64_t scan_count{0};
+
+  // number of scans that were selective enough to benefit from an index, and the number of rows that they would not
+  // have had to read with one
+  uint64_t selective_scan_count{0};
+  uint64_t skippable_row_count{0};
+
+  std::chrono::nanoseconds runtime{0};
+};
+
+struct IndexRecommendation {
+  std::string table_name;
+  ColumnID column_id;
+
+  // number of rows that the scans would not have to read with indexes on the column, weighted towards recent tuning
+  // periods
+  double benefit;
+
+  // estimated memory (in bytes) of the indexes on all chunks of the column
+  size_t memory_usage;
+};
+
+/**
+ * The IndexAdvisor is a singleton that chooses which columns are indexed, based on the predicates that TableScans
+ * evaluated on the tables of the StorageManager. The predicates are summed up per column when they are recorded, so
+ * that the recorded statistics do not grow with the number of scans. Scans that are executed as part of a pipeline
+ * (see execute_pipelined) process single chunks and are not recorded.
+ *
+ * Only selective predicates (see TableScan::INDEX_SCAN_MAX_SELECTIVITY) benefit from indexes, as the TableScan scans
+ * all other predicates sequentially anyway. The benefit of indexing a column is the number of rows that the selective
+ * scans on it would skip. Unlike their runtime, this does not drop once the index is used. As workloads shift,
+ * benefits from earlier tuning periods decay by BENEFIT_DECAY per call of tune, so that columns that are no longer
+ * filtered lose their indexes after a few periods.
+ *
+ * recommend picks the columns with the highest benefit per byte of estimated index memory until the memory budget is
+ * exhausted. tune additionally applies the recommendation: it creates a GroupKeyIndex on every DictionarySegment and a
+ * BTreeIndex on every ValueSegment (which is maintained when rows are appended) of the recommended columns, and drops
+ * the indexes that it created earlier on columns that are no longer recommended. Indexes created by others are never
+ * dropped. Recording is thread-safe, tuning must not run concurrently to queries.
+ */
+class IndexAdvisor : private Noncopyable {
+ public:
+  static constexpr auto BENEFIT_DECAY = 0.5;
+
+  static IndexAdvisor& get();
+
+  // Records a predicate evaluated on table, where selectivity is the fraction of the input rows that matched.
+  // Predicates on tables that are not in the StorageManager are ignored.
+  void record_predicate(const Table& table, const ColumnID column_id, const uint64_t input_row_count,
+                        const double selectivity, const std::chrono::nanoseconds runtime);
+
+  // returns the statistics of the predicates recorded since the last call of tune
+  std::vector<ColumnPredicateStatistics> predicate_statistics() const;
+
+  // returns the columns to index, ordered by decreasing benefit per byte
+  std::vector<IndexRecommendation> recommend(const size_t memory_budget) const;
+
+  // creates and drops indexes according to recommend and starts a new tuning period
+  std::vector<IndexRecommendation> tune(const size_t memory_budget);
+
+  // forgets all recorded predicates and created indexes, used especially in tests
+  void reset();
+
+  IndexAdvisor(IndexAdvisor&&) = delete;
+
+ protected:
+  using TableColumn = std::pair<std::string, ColumnID>;
+
+  IndexAdvisor() = default;
+
+  // returns the benefits of the finished tuning periods, decayed, plus those of the current period. Requires _mutex.
+  std::map<TableColumn, double> _current_benefits() const;
+
+  // returns the estimated memory of indexes on all chunks of the column
+  static size_t _estimate_memory_usage(const Table& table, const ColumnID column_id);
+
+  void _create_indexes(const TableColumn& table_column);
+  static void _drop_indexes(Table& table, const ColumnID column_id,
+                            const std::vector<std::weak_ptr<BaseIndex>>& created_indexes);
+
+  mutable std::mutex _mutex;
+  std::map<TableColumn, ColumnPredicateStatistics> _predicate_statistics;
+  std::map<TableColumn, double> _benefits;
+
+  // the indexes created by the advisor
+  std::map<TableColumn, std::vector<std::weak_ptr<BaseIndex>>> _created_indexes;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "strong_typedef.hpp"
+#include "utils/assert.hpp"
 
 /**
  * We use STRONG_TYPEDEF to avoid things like adding chunk ids and value ids.
@@ -37,6 +39,17 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// not strongly typed because they are used in std::atomics (see above)
+using TaskID = uint32_t;
+using WorkerID = uint32_t;
+
+// NUMA node, not strongly typed for consistency with WorkerID
+using NodeID = uint32_t;
+using CpuID = uint32_t;
+
+// used for chunks and tasks that are not bound to a node
+constexpr NodeID ANY_NODE_ID{std::numeric_limits<NodeID>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -53,7 +66,59 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// A list of positions, e.g., the rows of a table that satisfy a predicate. ReferenceSegments use it to describe which
+// rows of the referenced table they contain.
+//
+// Producers can attach guarantees about the content, which consumers can use to take faster paths. A guarantee is a
+// promise of the producer for the final content of the list, it is not updated when the vector is modified. In debug
+// builds, the guarantees are verified whenever they are queried.
+class PosList : public std::vector<RowID> {
+ public:
+  using std::vector<RowID>::vector;
+
+  // promises that all positions reference the same chunk
+  void guarantee_single_chunk() { _references_single_chunk = true; }
+
+  // promises that the positions are strictly ascending, i.e., sorted and free of duplicates
+  void guarantee_sorted() { _sorted = true; }
+
+  // returns true if it was guaranteed that all positions reference the same chunk (an empty list always does)
+  bool references_single_chunk() const {
+    if (empty()) return true;
+    DebugAssert(!_references_single_chunk || std::all_of(cbegin(), cend(),
+                                                         [&](const auto& row_id) {
+                                                           return row_id.chunk_id == front().chunk_id;
+                                                         }),
+                "PosList was guaranteed to reference a single chunk, but does not.");
+    return _references_single_chunk;
+  }
+
+  // returns true if it was guaranteed that the positions are strictly ascending (an empty list always is)
+  bool is_sorted() const {
+    if (empty()) return true;
+    DebugAssert(!_sorted || std::adjacent_find(cbegin(), cend(),
+                                               [](const auto& lhs, const auto& rhs) { return !(lhs < rhs); }) == cend(),
+                "PosList was guaranteed to be strictly ascending, but is not.");
+    return _sorted;
+  }
+
+  // returns true if the positions are known to form a gap-free range of offsets within a single chunk, e.g., because
+  // a scan selected all rows of a chunk
+  bool is_contiguous() const {
+    if (empty()) return true;
+    return references_single_chunk() && is_sorted() && back().chunk_offset - front().chunk_offset + 1 == size();
+  }
+
+  // returns the id of the chunk that all positions reference. Only valid if references_single_chunk() is true.
+  ChunkID common_chunk_id() const {
+    DebugAssert(!empty() && references_single_chunk(), "PosList does not reference a single chunk.");
+    return front().chunk_id;
+  }
+
+ protected:
+  bool _references_single_chunk{false};
+  bool _sorted{false};
+};
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
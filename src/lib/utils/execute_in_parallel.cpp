@@ -0,0 +1,72 @@
+#include "execute_in_parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void execute_in_parallel(const std::vector<std::function<void()>>& jobs, const std::vector<NodeID>& node_ids) {
+  DebugAssert(node_ids.empty() || node_ids.size() == jobs.size(), "Expected one node per job.");
+
+  if (CurrentScheduler::is_set() && jobs.size() > 1) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    tasks.reserve(jobs.size());
+    for (auto job_index = size_t{0}; job_index < jobs.size(); ++job_index) {
+      const auto& task = tasks.emplace_back(std::make_shared<JobTask>(jobs[job_index]));
+      if (!node_ids.empty()) task->set_node_id(node_ids[job_index]);
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return;
+  }
+
+  const auto thread_count =
+      std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), jobs.size());
+
+  if (thread_count <= 1) {
+    for (const auto& job : jobs) {
+      job();
+    }
+    return;
+  }
+
+  auto next_job_index = std::atomic<size_t>{0};
+  auto first_exception = std::exception_ptr{};
+  auto exception_mutex = std::mutex{};
+
+  // Each thread pulls the next job until all jobs are taken, so that jobs of different duration are balanced
+  const auto work = [&]() {
+    for (auto job_index = next_job_index++; job_index < jobs.size(); job_index = next_job_index++) {
+      try {
+        jobs[job_index]();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!first_exception) first_exception = std::current_exception();
+      }
+    }
+  };
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count - 1);
+  for (auto thread_id = size_t{1}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back(work);
+  }
+  work();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (first_exception) std::rethrow_exception(first_exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Executes all jobs and returns once all of them have finished. If a scheduler is set (see CurrentScheduler), each job
+ * becomes a task of that scheduler. Otherwise, jobs are distributed among up to std::thread::hardware_concurrency()
+ * threads, including the calling thread. Jobs must be independent of each other; their execution order is undefined.
+ *
+ * Without a scheduler, every call starts its own threads. Jobs should therefore not call execute_in_parallel
+ * themselves, as nested calls would run more threads than there are cores.
+ *
+ * If a job throws, the remaining jobs are still executed and the first exception is rethrown in the calling thread.
+ *
+ * node_ids optionally holds the NUMA node of each job (e.g., the node of the chunk it processes), whose workers the
+ * scheduler prefers for the job.
+ */
+void execute_in_parallel(const std::vector<std::function<void()>>& jobs, const std::vector<NodeID>& node_ids = {});
+
+}  // namespace opossum
@@ -6,8 +6,11 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "tuning/index_advisor.hpp"
 #include "type_cast.hpp"
 
 namespace opossum {
@@ -158,6 +161,12 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::get().reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::get().reset();
+  IndexAdvisor::get().reset();
+  // finishes the scheduler, if a test did not do that
+  CurrentScheduler::set(nullptr);
+  Topology::get().reset();
+}
 
 }  // namespace opossum
@@ -0,0 +1,62 @@
+#include <stdexcept>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class PosListTest : public BaseTest {};
+
+TEST_F(PosListTest, NoGuaranteesByDefault) {
+  const auto pos_list = PosList{{ChunkID{0}, 0}, {ChunkID{0}, 1}};
+
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.is_sorted());
+  EXPECT_FALSE(pos_list.is_contiguous());
+}
+
+TEST_F(PosListTest, EmptyListFulfillsAllGuarantees) {
+  const auto pos_list = PosList{};
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.is_sorted());
+  EXPECT_TRUE(pos_list.is_contiguous());
+}
+
+TEST_F(PosListTest, Guarantees) {
+  auto pos_list = PosList{{ChunkID{3}, 2}, {ChunkID{3}, 4}, {ChunkID{3}, 5}};
+  pos_list.guarantee_single_chunk();
+  pos_list.guarantee_sorted();
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.is_sorted());
+  EXPECT_FALSE(pos_list.is_contiguous());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+
+  pos_list[0].chunk_offset = 3;
+  EXPECT_TRUE(pos_list.is_contiguous());
+}
+
+TEST_F(PosListTest, GuaranteesAreKeptWhenCopied) {
+  auto pos_list = PosList{{ChunkID{1}, 2}};
+  pos_list.guarantee_single_chunk();
+
+  const auto copy = pos_list;
+  EXPECT_TRUE(copy.references_single_chunk());
+  EXPECT_FALSE(copy.is_sorted());
+}
+
+#if IS_DEBUG
+TEST_F(PosListTest, ViolatedGuaranteesAreDetected) {
+  auto pos_list = PosList{{ChunkID{0}, 2}, {ChunkID{1}, 1}, {ChunkID{1}, 1}};
+  pos_list.guarantee_single_chunk();
+  pos_list.guarantee_sorted();
+
+  EXPECT_THROW(pos_list.references_single_chunk(), std::logic_error);
+  EXPECT_THROW(pos_list.is_sorted(), std::logic_error);
+}
+#endif
+
+}  // namespace opossum
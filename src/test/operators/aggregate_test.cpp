@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/aggregate_input.tbl", 2));
+    _table_wrapper->execute();
+
+    auto table_dict = load_table("src/test/tables/aggregate_input.tbl", 2);
+    table_dict->compress_chunk(ChunkID{0});
+    table_dict->compress_chunk(ChunkID{2});
+    _table_wrapper_dict = std::make_shared<TableWrapper>(table_dict);
+    _table_wrapper_dict->execute();
+  }
+
+  std::vector<AggregateColumnDefinition> _all_aggregate_functions() const {
+    return {{ColumnID{1}, AggregateFunction::Sum},
+            {std::nullopt, AggregateFunction::Count},
+            {ColumnID{2}, AggregateFunction::Min},
+            {ColumnID{1}, AggregateFunction::Max},
+            {ColumnID{1}, AggregateFunction::Avg},
+            {ColumnID{2}, AggregateFunction::CountDistinct}};
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsAggregateTest, GroupBySingleColumn) {
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, _all_aggregate_functions(), std::vector{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), load_table("src/test/tables/aggregate_group_by_a_result.tbl", 1));
+}
+
+TEST_F(OperatorsAggregateTest, GroupByMultipleColumns) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                  {ColumnID{1}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper_dict, aggregates, std::vector{ColumnID{0}, ColumnID{2}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), load_table("src/test/tables/aggregate_group_by_a_c_result.tbl", 1));
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryAndReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{_table_wrapper_dict, scan}) {
+    auto aggregate = std::make_shared<Aggregate>(input, _all_aggregate_functions(), std::vector{ColumnID{0}});
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ(aggregate->get_output(), load_table("src/test/tables/aggregate_group_by_a_result.tbl", 1));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupByValueIDs) {
+  // Each chunk has its own dictionary, so equal values have different value ids in different chunks
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("s", "string");
+  table->add_column("n", "int");
+  for (auto row = 0; row < 4500; ++row) {
+    table->append({"s" + std::to_string(row * 7 % 37), row % 13});
+  }
+  auto table_dict = std::make_shared<Table>(1000);
+  table_dict->add_column("s", "string");
+  table_dict->add_column("n", "int");
+  for (auto row = 0; row < 4500; ++row) {
+    table_dict->append({"s" + std::to_string(row * 7 % 37), row % 13});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < ChunkID{4}; ++chunk_id) {
+    table_dict->compress_chunk(chunk_id);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto table_wrapper_dict = std::make_shared<TableWrapper>(table_dict);
+  table_wrapper_dict->execute();
+  auto scan_dict = std::make_shared<TableScan>(table_wrapper_dict, ColumnID{1}, ScanType::OpGreaterThan, -1);
+  scan_dict->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                  {ColumnID{1}, AggregateFunction::Sum}};
+  for (const auto& group_by_column_ids : {std::vector{ColumnID{0}}, std::vector{ColumnID{0}, ColumnID{1}},
+                                          std::vector{ColumnID{1}, ColumnID{0}}}) {
+    auto expected = std::make_shared<Aggregate>(table_wrapper, aggregates, group_by_column_ids);
+    expected->execute();
+
+    for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper_dict, scan_dict}) {
+      auto aggregate = std::make_shared<Aggregate>(input, aggregates, group_by_column_ids);
+      aggregate->execute();
+      EXPECT_TABLE_EQ(aggregate->get_output(), expected->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupBy) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                                                  {std::nullopt, AggregateFunction::Count},
+                                                                  {ColumnID{2}, AggregateFunction::Min},
+                                                                  {ColumnID{2}, AggregateFunction::Max},
+                                                                  {ColumnID{0}, AggregateFunction::Avg}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper_dict, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), load_table("src/test/tables/aggregate_no_group_by_result.tbl", 1));
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupByOnAllSegmentTypes) {
+  // A dictionary-encoded chunk that is split into several morsels, a small dictionary-encoded chunk that is aggregated
+  // as a whole, and a chunk of value segments
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  table->add_column_definition("b", "float");
+
+  auto all_values = std::vector<int32_t>{};
+  for (const auto& [row_count, compress] : {std::pair{2 * Aggregate::MORSEL_SIZE + 123, true},
+                                           std::pair{ChunkOffset{1000}, true}, std::pair{ChunkOffset{1001}, false}}) {
+    auto int_values = std::vector<int32_t>(row_count);
+    auto float_values = std::vector<float>(row_count);
+    for (auto row = ChunkOffset{0}; row < row_count; ++row) {
+      int_values[row] = static_cast<int32_t>((all_values.size() * 7919) % 100'003) - 50'000;
+      float_values[row] = static_cast<float>(int_values[row]) * 0.5f;
+      all_values.emplace_back(int_values[row]);
+    }
+
+    Chunk chunk;
+    const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values));
+    const auto float_segment = std::make_shared<ValueSegment<float>>(std::move(float_values));
+    if (compress) {
+      chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_segment));
+      chunk.add_segment(std::make_shared<DictionarySegment<float>>(float_segment));
+    } else {
+      chunk.add_segment(int_segment);
+      chunk.add_segment(float_segment);
+    }
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 100'000);
+  scan->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {std::nullopt, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Sum},
+      {ColumnID{0}, AggregateFunction::Min},    {ColumnID{0}, AggregateFunction::Max},
+      {ColumnID{1}, AggregateFunction::Sum},    {ColumnID{1}, AggregateFunction::Min},
+      {ColumnID{1}, AggregateFunction::Avg},    {ColumnID{0}, AggregateFunction::CountDistinct}};
+
+  const auto sum = std::accumulate(all_values.cbegin(), all_values.cend(), int64_t{0});
+  const auto minmax = std::minmax_element(all_values.cbegin(), all_values.cend());
+  const auto distinct_count = std::unordered_set<int32_t>(all_values.cbegin(), all_values.cend()).size();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("MIN(a)", "int");
+  expected->add_column("MAX(a)", "int");
+  expected->add_column("SUM(b)", "double");
+  expected->add_column("MIN(b)", "float");
+  expected->add_column("AVG(b)", "double");
+  expected->add_column("COUNT(DISTINCT a)", "long");
+  expected->append({static_cast<int64_t>(all_values.size()), sum, *minmax.first, *minmax.second, sum * 0.5,
+                    *minmax.first * 0.5f, sum * 0.5 / all_values.size(), static_cast<int64_t>(distinct_count)});
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, scan}) {
+    auto aggregate = std::make_shared<Aggregate>(input, aggregates, std::vector<ColumnID>{});
+    aggregate->execute();
+    EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupByWithoutAggregates) {
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                               std::vector{ColumnID{2}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("c", "string");
+  for (const auto& value : {"x", "y", "z"}) expected->append({value});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                  {ColumnID{0}, AggregateFunction::Sum}};
+
+  // Without group by columns, COUNT(*) and SUM return 0 for an empty input
+  auto aggregate = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(a)", "long");
+  expected->append({int64_t{0}, int64_t{0}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+
+  // With group by columns, there are no groups
+  auto aggregate_grouped = std::make_shared<Aggregate>(scan, aggregates, std::vector{ColumnID{2}});
+  aggregate_grouped->execute();
+  EXPECT_EQ(aggregate_grouped->get_output()->row_count(), 0u);
+  EXPECT_EQ(aggregate_grouped->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroupsAndMorsels) {
+  // Chunks larger than a morsel and enough groups to merge them in several partitions
+  const auto row_count = 3 * Aggregate::MORSEL_SIZE;
+  const auto group_count = 20'011;
+
+  auto values = std::vector<int32_t>(row_count);
+  for (auto row = ChunkOffset{0}; row < row_count; ++row) {
+    values[row] = static_cast<int32_t>(row % group_count);
+  }
+
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  Chunk chunk;
+  chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::move(values)));
+  table->emplace_chunk(std::move(chunk));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                  {ColumnID{0}, AggregateFunction::Max}};
+  auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, std::vector{ColumnID{0}});
+  aggregate->execute();
+
+  const auto output = aggregate->get_output();
+  ASSERT_EQ(output->row_count(), static_cast<uint64_t>(group_count));
+
+  auto total_count = int64_t{0};
+  auto all_match = true;
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& output_chunk = output->get_chunk(chunk_id);
+    const auto& keys =
+        std::dynamic_pointer_cast<ValueSegment<int32_t>>(output_chunk.get_segment(ColumnID{0}))->values();
+    const auto& counts =
+        std::dynamic_pointer_cast<ValueSegment<int64_t>>(output_chunk.get_segment(ColumnID{1}))->values();
+    const auto& maxima =
+        std::dynamic_pointer_cast<ValueSegment<int32_t>>(output_chunk.get_segment(ColumnID{2}))->values();
+
+    for (auto index = size_t{0}; index < keys.size(); ++index) {
+      const auto key = static_cast<ChunkOffset>(keys[index]);
+      const auto expected_count = row_count / group_count + (key < row_count % group_count ? 1 : 0);
+      all_match &= counts[index] == expected_count;
+      all_match &= maxima[index] == keys[index];
+      total_count += counts[index];
+    }
+  }
+  EXPECT_TRUE(all_match);
+  EXPECT_EQ(total_count, row_count);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(std::make_shared<Aggregate>(_table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                           std::vector<ColumnID>{}),
+               std::logic_error);
+
+  const auto sum_all_rows = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Sum}};
+  EXPECT_THROW(std::make_shared<Aggregate>(_table_wrapper, sum_all_rows, std::vector<ColumnID>{}), std::logic_error);
+
+  const auto sum_strings = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, sum_strings, std::vector<ColumnID>{});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
+}  // namespace opossum
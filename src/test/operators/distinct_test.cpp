@@ -0,0 +1,130 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/distinct.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsDistinctTest : public BaseTest {
+ protected:
+  static std::shared_ptr<const Table> _distinct(const std::shared_ptr<const AbstractOperator>& in) {
+    auto distinct = std::make_shared<Distinct>(in);
+    distinct->execute();
+    return distinct->get_output();
+  }
+
+  static std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+};
+
+TEST_F(OperatorsDistinctTest, SingleDictionaryColumn) {
+  // 10 full, dictionary-encoded chunks and one chunk of ValueSegments
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "string");
+  for (auto row = 0; row < 1050; ++row) {
+    table->append({"v" + std::to_string((row * 7) % 130 + 100)});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < 10; ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "string");
+  for (auto value = 100; value < 230; ++value) {
+    expected->append({"v" + std::to_string(value)});
+  }
+
+  const auto output = _distinct(_wrap(table));
+  EXPECT_TABLE_EQ(output, expected, true);
+  const auto segment = output->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<std::string>>(segment));
+}
+
+TEST_F(OperatorsDistinctTest, SingleColumnWithoutDictionaries) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  for (const auto value : {3, -1, 3, 2, -1, 2, 3, 10}) {
+    table->append({value});
+  }
+  auto table_wrapper = _wrap(table);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (const auto value : {-1, 2, 3, 10}) {
+    expected->append({value});
+  }
+  EXPECT_TABLE_EQ(_distinct(table_wrapper), expected);
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan->execute();
+  expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (const auto value : {-1, 2, 3}) {
+    expected->append({value});
+  }
+  EXPECT_TABLE_EQ(_distinct(scan), expected);
+}
+
+TEST_F(OperatorsDistinctTest, SingleColumnWithDictionariesAndValueSegments) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  for (const auto value : {3, -1, 3, 2, -1, 2, 3, 10}) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (const auto value : {-1, 2, 3, 10}) {
+    expected->append({value});
+  }
+  EXPECT_TABLE_EQ(_distinct(_wrap(table)), expected, true);
+}
+
+TEST_F(OperatorsDistinctTest, MultipleColumns) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (const auto value : {1, 2, 1, 3, 2, 1, 1}) {
+    table->append({value, value == 3 ? "three" : "other"});
+  }
+  table->compress_chunk(ChunkID{1});
+  auto table_wrapper = _wrap(table);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({1, "other"});
+  expected->append({2, "other"});
+  expected->append({3, "three"});
+  EXPECT_TABLE_EQ(_distinct(table_wrapper), expected);
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({2, "other"});
+  expected->append({3, "three"});
+  EXPECT_TABLE_EQ(_distinct(scan), expected);
+}
+
+TEST_F(OperatorsDistinctTest, EmptyInput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  EXPECT_EQ(_distinct(_wrap(table))->row_count(), 0u);
+}
+
+}  // namespace opossum
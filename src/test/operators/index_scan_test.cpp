@@ -0,0 +1,161 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // (tenant, user, day) in four chunks: chunk 0 has a composite index, chunk 1 an index on tenant only, chunk 2 an
+    // index on user, and chunk 3 (which is not compressed) none
+    auto random_engine = std::mt19937{42};
+    auto tenant_distribution = std::uniform_int_distribution<int32_t>{0, 4};
+    auto user_distribution = std::uniform_int_distribution<int32_t>{0, 9};
+    auto day_distribution = std::uniform_int_distribution<int32_t>{1, 31};
+
+    _indexed_table = std::make_shared<Table>(300);
+    _unindexed_table = std::make_shared<Table>(300);
+    for (const auto& table : {_indexed_table, _unindexed_table}) {
+      table->add_column("tenant", "int");
+      table->add_column("user", "string");
+      table->add_column("day", "int");
+    }
+    for (auto row = 0; row < 1000; ++row) {
+      const auto values = std::vector<AllTypeVariant>{tenant_distribution(random_engine),
+                                                      "user" + std::to_string(user_distribution(random_engine)),
+                                                      day_distribution(random_engine)};
+      _indexed_table->append(values);
+      _unindexed_table->append(values);
+    }
+    for (ChunkID chunk_id{0}; chunk_id < 3; ++chunk_id) {
+      _indexed_table->compress_chunk(chunk_id);
+      _unindexed_table->compress_chunk(chunk_id);
+    }
+
+    _indexed_table->get_chunk(ChunkID{0}).create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}, ColumnID{2}});
+    _indexed_table->get_chunk(ChunkID{1}).create_index<GroupKeyIndex>({ColumnID{0}});
+    _indexed_table->get_chunk(ChunkID{2}).create_index<BTreeIndex>({ColumnID{1}});
+
+    _indexed_wrapper = std::make_shared<TableWrapper>(_indexed_table);
+    _indexed_wrapper->execute();
+    _unindexed_wrapper = std::make_shared<TableWrapper>(_unindexed_table);
+    _unindexed_wrapper->execute();
+  }
+
+  // Evaluates the predicate of an IndexScan with TableScans on the unindexed table
+  std::shared_ptr<const Table> _expected_output(const std::vector<ColumnID>& column_ids, const ScanType scan_type,
+                                                const std::vector<AllTypeVariant>& search_values) {
+    auto scan = std::shared_ptr<const AbstractOperator>{_unindexed_wrapper};
+    for (auto position = size_t{0}; position < column_ids.size(); ++position) {
+      const auto column_scan_type = position + 1 < column_ids.size() ? ScanType::OpEquals : scan_type;
+      scan = std::make_shared<TableScan>(scan, column_ids[position], column_scan_type, search_values[position]);
+      std::const_pointer_cast<AbstractOperator>(scan)->execute();
+    }
+    return scan->get_output();
+  }
+
+  const std::vector<ScanType> _scan_types{ScanType::OpEquals,         ScanType::OpNotEquals,
+                                          ScanType::OpLessThan,       ScanType::OpLessThanEquals,
+                                          ScanType::OpGreaterThan,    ScanType::OpGreaterThanEquals};
+
+  std::shared_ptr<Table> _indexed_table, _unindexed_table;
+  std::shared_ptr<TableWrapper> _indexed_wrapper, _unindexed_wrapper;
+};
+
+TEST_F(OperatorsIndexScanTest, SingleColumn) {
+  for (const auto scan_type : _scan_types) {
+    auto scan = std::make_shared<IndexScan>(_indexed_wrapper, std::vector<ColumnID>{ColumnID{0}}, scan_type,
+                                            std::vector<AllTypeVariant>{2});
+    scan->execute();
+    EXPECT_TABLE_EQ(scan->get_output(), _expected_output({ColumnID{0}}, scan_type, {2}), true);
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, CompositeColumns) {
+  for (const auto scan_type : _scan_types) {
+    const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}, ColumnID{2}};
+    const auto search_values = std::vector<AllTypeVariant>{3, "user7", 15};
+    auto scan = std::make_shared<IndexScan>(_indexed_wrapper, column_ids, scan_type, search_values);
+    scan->execute();
+    EXPECT_TABLE_EQ(scan->get_output(), _expected_output(column_ids, scan_type, search_values), true);
+  }
+
+  // equality on the first column and a range on the second one
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  auto scan = std::make_shared<IndexScan>(_indexed_wrapper, column_ids, ScanType::OpGreaterThanEquals,
+                                          std::vector<AllTypeVariant>{1, "user5"});
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _expected_output(column_ids, ScanType::OpGreaterThanEquals, {1, "user5"}), true);
+}
+
+TEST_F(OperatorsIndexScanTest, FindIndex) {
+  const auto& chunk = _indexed_table->get_chunk(ChunkID{0});
+  EXPECT_NE(IndexScan::find_index(chunk, {ColumnID{0}}), nullptr);
+  EXPECT_NE(IndexScan::find_index(chunk, {ColumnID{0}, ColumnID{1}}), nullptr);
+  EXPECT_EQ(IndexScan::find_index(chunk, {ColumnID{1}}), nullptr);
+  EXPECT_EQ(IndexScan::find_index(chunk, {ColumnID{0}, ColumnID{2}}), nullptr);
+  EXPECT_EQ(IndexScan::find_index(_indexed_table->get_chunk(ChunkID{3}), {ColumnID{0}}), nullptr);
+}
+
+TEST_F(OperatorsIndexScanTest, ReferenceSegmentInput) {
+  auto table_scan = std::make_shared<TableScan>(_indexed_wrapper, ColumnID{2}, ScanType::OpLessThan, 10);
+  table_scan->execute();
+
+  auto scan = std::make_shared<IndexScan>(table_scan, std::vector<ColumnID>{ColumnID{1}}, ScanType::OpEquals,
+                                          std::vector<AllTypeVariant>{"user3"});
+  scan->execute();
+
+  auto expected_scan = std::make_shared<TableScan>(table_scan, ColumnID{1}, ScanType::OpEquals, "user3");
+  expected_scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), expected_scan->get_output(), true);
+}
+
+TEST_F(OperatorsIndexScanTest, EmptyResult) {
+  auto scan = std::make_shared<IndexScan>(_indexed_wrapper, std::vector<ColumnID>{ColumnID{0}}, ScanType::OpGreaterThan,
+                                          std::vector<AllTypeVariant>{4});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->column_count(), 3u);
+}
+
+TEST_F(OperatorsIndexScanTest, TableScanUsesIndexes) {
+  // Selective predicates are answered through the indexes of chunks 0 to 2, the others sequentially
+  for (const auto scan_type : _scan_types) {
+    for (const auto& search_value : {AllTypeVariant{"user0"}, AllTypeVariant{"user99"}}) {
+      auto scan = std::make_shared<TableScan>(_indexed_wrapper, ColumnID{1}, scan_type, search_value);
+      scan->execute();
+      EXPECT_TABLE_EQ(scan->get_output(), _expected_output({ColumnID{1}}, scan_type, {search_value}), true);
+    }
+    for (const auto& search_value : {AllTypeVariant{-1}, AllTypeVariant{0}, AllTypeVariant{4}}) {
+      auto scan = std::make_shared<TableScan>(_indexed_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      EXPECT_TABLE_EQ(scan->get_output(), _expected_output({ColumnID{0}}, scan_type, {search_value}), true);
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, ThrowsOnInvalidArguments) {
+  EXPECT_THROW(std::make_shared<IndexScan>(_indexed_wrapper, std::vector<ColumnID>{}, ScanType::OpEquals,
+                                           std::vector<AllTypeVariant>{}),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<IndexScan>(_indexed_wrapper, std::vector<ColumnID>{ColumnID{0}}, ScanType::OpEquals,
+                                           std::vector<AllTypeVariant>{1, 2}),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,199 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+
+    _table_wrapper_right = std::make_shared<TableWrapper>(load_table("src/test/tables/join_right.tbl", 2));
+    _table_wrapper_right->execute();
+
+    auto table_left_dict = load_table("src/test/tables/join_left.tbl", 2);
+    auto table_right_dict = load_table("src/test/tables/join_right.tbl", 2);
+    // only full chunks can be compressed, so the last chunk of the right table stays a ValueSegment
+    for (const auto& table : {table_left_dict, table_right_dict}) {
+      for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        if (table->get_chunk(chunk_id).size() == table->chunk_size()) table->compress_chunk(chunk_id);
+      }
+    }
+
+    _table_wrapper_left_dict = std::make_shared<TableWrapper>(table_left_dict);
+    _table_wrapper_left_dict->execute();
+
+    _table_wrapper_right_dict = std::make_shared<TableWrapper>(table_right_dict);
+    _table_wrapper_right_dict->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  std::shared_ptr<TableWrapper> _table_wrapper_left_dict, _table_wrapper_right_dict;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinIntColumns) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_int_result.tbl", 1));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStringColumns) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                         std::make_pair(ColumnID{2}, ColumnID{1}), ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_string_result.tbl", 1));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinDictionarySegments) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left_dict, _table_wrapper_right,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_int_result.tbl", 1));
+
+  auto join_dict = std::make_shared<JoinHash>(_table_wrapper_left_dict, _table_wrapper_right_dict,
+                                              std::make_pair(ColumnID{2}, ColumnID{1}), ScanType::OpEquals);
+  join_dict->execute();
+  EXPECT_TABLE_EQ(join_dict->get_output(), load_table("src/test/tables/join_equals_string_result.tbl", 1));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferenceSegments) {
+  auto scan_left = std::make_shared<TableScan>(_table_wrapper_left_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_left->execute();
+  auto scan_right = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpLessThan, 7);
+  scan_right->execute();
+
+  auto join = std::make_shared<JoinHash>(scan_left, scan_right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  const auto output = join->get_output();
+  ASSERT_EQ(output->row_count(), 2u);
+  EXPECT_EQ(type_cast<std::string>((*output->get_chunk(ChunkID{0}).get_segment(ColumnID{2}))[0]), "three");
+
+  // The output references the tables that store the data, not the outputs of the scans
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(column_id));
+      ASSERT_TRUE(segment);
+      const auto& expected_table =
+          column_id < 3 ? _table_wrapper_left_dict->get_output() : _table_wrapper_right->get_output();
+      EXPECT_EQ(segment->referenced_table(), expected_table);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, ScanJoinOutput) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right_dict,
+                                         std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  join->execute();
+
+  // The columns of the join output reference two different tables
+  auto scan = std::make_shared<TableScan>(join, ColumnID{4}, ScanType::OpEquals, "three_b");
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  EXPECT_EQ(type_cast<float>((*chunk.get_segment(ColumnID{1}))[0]), 3.5f);
+  EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{4}))[0]), "three_b");
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  const auto output = join->get_output();
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->column_count(), 5u);
+  EXPECT_EQ(output->chunk_count(), ChunkID{1});
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).column_count(), 5u);
+}
+
+TEST_F(OperatorsJoinHashTest, ThrowsOnInvalidArguments) {
+  EXPECT_THROW(std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                          std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpLessThan),
+               std::logic_error);
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                         std::make_pair(ColumnID{0}, ColumnID{1}), ScanType::OpEquals);
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitions) {
+  // Large enough to be split into several partitions
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, 20'000};
+
+  auto left_table = std::make_shared<Table>(1000);
+  left_table->add_column("a", "int");
+  left_table->add_column("b", "int");
+  auto right_table = std::make_shared<Table>(700);
+  right_table->add_column("c", "int");
+
+  auto right_value_counts = std::unordered_map<int32_t, size_t>{};
+  for (auto row = 0; row < 20'000; ++row) {
+    const auto value = distribution(random_engine);
+    right_table->append({value});
+    ++right_value_counts[value];
+  }
+
+  auto expected_row_count = size_t{0};
+  for (auto row = 0; row < 30'000; ++row) {
+    const auto value = distribution(random_engine);
+    left_table->append({value, row});
+    expected_row_count += right_value_counts[value];
+  }
+  left_table->compress_chunk(ChunkID{3});
+  right_table->compress_chunk(ChunkID{5});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  const auto output = join->get_output();
+  ASSERT_EQ(output->row_count(), expected_row_count);
+  EXPECT_GT(output->chunk_count(), ChunkID{1});
+
+  auto all_match = true;
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    const auto& left_segment = *chunk.get_segment(ColumnID{0});
+    const auto& right_segment = *chunk.get_segment(ColumnID{2});
+    for (ChunkOffset offset{0}; offset < chunk.size(); ++offset) {
+      all_match &= type_cast<int32_t>(left_segment[offset]) == type_cast<int32_t>(right_segment[offset]);
+    }
+  }
+  EXPECT_TRUE(all_match);
+}
+
+}  // namespace opossum
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_index.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Index that sorts the offsets of a single segment by their values. It counts its lookups so that the tests can check
+// that JoinIndex actually uses it.
+class SortedTestIndex : public BaseIndex {
+ public:
+  explicit SortedTestIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments) : _segments(segments) {
+    const auto& segment = *_segments.front();
+    for (ChunkOffset offset{0}; offset < segment.size(); ++offset) {
+      _offsets.emplace_back(offset);
+    }
+    std::stable_sort(_offsets.begin(), _offsets.end(),
+                     [&](const auto lhs, const auto rhs) { return segment[lhs] < segment[rhs]; });
+    _block = OffsetBlock{_offsets.data(), _offsets.data() + _offsets.size(), nullptr};
+  }
+
+  mutable size_t lookup_count{0};
+
+ protected:
+  Iterator _on_lower_bound(const std::vector<AllTypeVariant>& values) const override {
+    ++lookup_count;
+    const auto is_less = [&](const auto offset, const auto& value) { return (*_segments.front())[offset] < value; };
+    return Iterator{_block, std::lower_bound(_block.begin, _block.end, values.front(), is_less)};
+  }
+
+  Iterator _on_upper_bound(const std::vector<AllTypeVariant>& values) const override {
+    ++lookup_count;
+    const auto is_less = [&](const auto& value, const auto offset) { return value < (*_segments.front())[offset]; };
+    return Iterator{_block, std::upper_bound(_block.begin, _block.end, values.front(), is_less)};
+  }
+
+  Iterator _on_cbegin() const override { return Iterator{_block, _block.begin}; }
+  Iterator _on_cend() const override { return Iterator{_block, _block.end}; }
+  std::vector<std::shared_ptr<const BaseSegment>> _on_get_indexed_segments() const override { return _segments; }
+
+  const std::vector<std::shared_ptr<const BaseSegment>> _segments;
+  std::vector<ChunkOffset> _offsets;
+  OffsetBlock _block;
+};
+
+class OperatorsJoinIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+
+    // Chunks 0 and 1 of the inner table are indexed on both columns, chunk 2 is not indexed
+    auto table_right = load_table("src/test/tables/join_right.tbl", 2);
+    table_right->compress_chunk(ChunkID{0});
+    for (const auto& chunk_id : {ChunkID{0}, ChunkID{1}}) {
+      for (const auto& column_id : {ColumnID{0}, ColumnID{1}}) {
+        _indexes.emplace_back(table_right->get_chunk(chunk_id).create_index<SortedTestIndex>({column_id}));
+      }
+    }
+
+    _table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+    _table_wrapper_right->execute();
+  }
+
+  size_t _lookup_count() const {
+    auto lookup_count = size_t{0};
+    for (const auto& index : _indexes) lookup_count += index->lookup_count;
+    return lookup_count;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  std::vector<std::shared_ptr<SortedTestIndex>> _indexes;
+};
+
+TEST_F(OperatorsJoinIndexTest, JoinIntColumns) {
+  auto join = std::make_shared<JoinIndex>(_table_wrapper_left, _table_wrapper_right,
+                                          std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_int_result.tbl", 1));
+
+  // Each of the six outer rows is looked up in the indexes of the two indexed chunks
+  EXPECT_EQ(_lookup_count(), 6u * 2u * 2u);
+}
+
+TEST_F(OperatorsJoinIndexTest, JoinStringColumns) {
+  auto join = std::make_shared<JoinIndex>(_table_wrapper_left, _table_wrapper_right,
+                                          std::make_pair(ColumnID{2}, ColumnID{1}), ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_string_result.tbl", 1));
+}
+
+TEST_F(OperatorsJoinIndexTest, AllScanTypesMatchSortMergeJoin) {
+  const auto int_columns = std::make_pair(ColumnID{0}, ColumnID{0});
+  const auto string_columns = std::make_pair(ColumnID{2}, ColumnID{1});
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto& column_ids : {int_columns, string_columns}) {
+      auto join = std::make_shared<JoinIndex>(_table_wrapper_left, _table_wrapper_right, column_ids, scan_type);
+      join->execute();
+
+      auto expected = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right, column_ids, scan_type);
+      expected->execute();
+
+      EXPECT_TABLE_EQ(join->get_output(), expected->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsJoinIndexTest, InnerReferenceSegmentsAreProbed) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan->execute();
+
+  // The TableScan may use the indexes itself
+  const auto lookup_count_before_join = _lookup_count();
+
+  auto join = std::make_shared<JoinIndex>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                          ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 3u);
+  EXPECT_EQ(_lookup_count(), lookup_count_before_join);
+}
+
+TEST_F(OperatorsJoinIndexTest, EmptyOuterInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto join = std::make_shared<JoinIndex>(scan, _table_wrapper_right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                          ScanType::OpLessThan);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 5u);
+}
+
+}  // namespace opossum
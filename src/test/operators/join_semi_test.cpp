@@ -0,0 +1,122 @@
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_semi.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSemiTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(load_table("src/test/tables/join_right.tbl", 2));
+    _table_wrapper_right->execute();
+
+    auto table_left_dict = load_table("src/test/tables/join_left.tbl", 2);
+    table_left_dict->compress_chunk(ChunkID{0});
+    table_left_dict->compress_chunk(ChunkID{1});
+    _table_wrapper_left_dict = std::make_shared<TableWrapper>(table_left_dict);
+    _table_wrapper_left_dict->execute();
+
+    _expected_semi = std::make_shared<Table>();
+    _expected_anti = std::make_shared<Table>();
+    for (const auto& table : {_expected_semi, _expected_anti}) {
+      table->add_column("a", "int");
+      table->add_column("b", "float");
+      table->add_column("c", "string");
+    }
+    _expected_semi->append({2, 2.5f, "two"});
+    _expected_semi->append({2, 2.6f, "two_b"});
+    _expected_semi->append({3, 3.5f, "three"});
+    _expected_semi->append({7, 7.5f, "seven"});
+    _expected_anti->append({1, 1.5f, "one"});
+    _expected_anti->append({5, 5.5f, "five"});
+  }
+
+  static std::shared_ptr<const Table> _join(const std::shared_ptr<const AbstractOperator>& left,
+                                            const std::shared_ptr<const AbstractOperator>& right,
+                                            const std::pair<ColumnID, ColumnID>& column_ids, const SemiJoinMode mode) {
+    auto join = std::make_shared<JoinSemi>(left, right, column_ids, mode);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right, _table_wrapper_left_dict;
+  std::shared_ptr<Table> _expected_semi, _expected_anti;
+};
+
+TEST_F(OperatorsJoinSemiTest, IntColumns) {
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{0});
+  for (const auto& left : {_table_wrapper_left, _table_wrapper_left_dict}) {
+    EXPECT_TABLE_EQ(_join(left, _table_wrapper_right, column_ids, SemiJoinMode::Semi), _expected_semi, true);
+    EXPECT_TABLE_EQ(_join(left, _table_wrapper_right, column_ids, SemiJoinMode::Anti), _expected_anti, true);
+  }
+}
+
+TEST_F(OperatorsJoinSemiTest, StringColumnsAndReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_left_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan->execute();
+
+  const auto output = _join(scan, _table_wrapper_right, std::make_pair(ColumnID{2}, ColumnID{1}), SemiJoinMode::Anti);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "float");
+  expected->add_column("c", "string");
+  expected->append({5, 5.5f, "five"});
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsJoinSemiTest, SparseKeys) {
+  // keys whose range is too large for a bitmap
+  auto left_table = std::make_shared<Table>(100);
+  left_table->add_column("a", "long");
+  auto right_table = std::make_shared<Table>(100);
+  right_table->add_column("b", "long");
+  for (auto value = int64_t{0}; value < 1000; ++value) {
+    left_table->append({value * 1'000'000'007});
+    if (value % 3 == 0) right_table->append({value * 1'000'000'007});
+  }
+  right_table->append({std::numeric_limits<int64_t>::min()});
+  right_table->append({std::numeric_limits<int64_t>::max()});
+  left_table->compress_chunk(ChunkID{3});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(_join(left_wrapper, right_wrapper, column_ids, SemiJoinMode::Semi)->row_count(), 334u);
+  EXPECT_EQ(_join(left_wrapper, right_wrapper, column_ids, SemiJoinMode::Anti)->row_count(), 666u);
+}
+
+TEST_F(OperatorsJoinSemiTest, EmptyRightInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{0});
+  const auto semi_output = _join(_table_wrapper_left, scan, column_ids, SemiJoinMode::Semi);
+  EXPECT_EQ(semi_output->row_count(), 0u);
+  EXPECT_EQ(semi_output->get_chunk(ChunkID{0}).column_count(), 3u);
+  EXPECT_TABLE_EQ(_join(_table_wrapper_left, scan, column_ids, SemiJoinMode::Anti), _table_wrapper_left->get_output(),
+                  true);
+}
+
+TEST_F(OperatorsJoinSemiTest, ThrowsOnTypeMismatch) {
+  auto join = std::make_shared<JoinSemi>(_table_wrapper_left, _table_wrapper_right,
+                                         std::make_pair(ColumnID{1}, ColumnID{0}), SemiJoinMode::Semi);
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_left = load_table("src/test/tables/join_left.tbl", 2);
+    _table_right = load_table("src/test/tables/join_right.tbl", 2);
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(_table_left);
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(_table_right);
+    _table_wrapper_right->execute();
+
+    auto table_left_dict = load_table("src/test/tables/join_left.tbl", 2);
+    for (ChunkID chunk_id{0}; chunk_id < table_left_dict->chunk_count(); ++chunk_id) {
+      table_left_dict->compress_chunk(chunk_id);
+    }
+    _table_wrapper_left_dict = std::make_shared<TableWrapper>(table_left_dict);
+    _table_wrapper_left_dict->execute();
+  }
+
+  // Joins the tables with nested loops over their values
+  static std::shared_ptr<Table> _nested_loop_join(const Table& left, const Table& right,
+                                                  const std::pair<ColumnID, ColumnID>& column_ids,
+                                                  const ScanType scan_type) {
+    auto result = std::make_shared<Table>();
+    for (const auto table : {&left, &right}) {
+      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+        result->add_column(table->column_name(column_id), table->column_type(column_id));
+      }
+    }
+
+    for (const auto& left_row : _rows(left)) {
+      for (const auto& right_row : _rows(right)) {
+        const auto& left_value = left_row[column_ids.first];
+        const auto& right_value = right_row[column_ids.second];
+
+        auto matches = false;
+        switch (scan_type) {
+          case ScanType::OpEquals:
+            matches = left_value == right_value;
+            break;
+          case ScanType::OpNotEquals:
+            matches = !(left_value == right_value);
+            break;
+          case ScanType::OpLessThan:
+            matches = left_value < right_value;
+            break;
+          case ScanType::OpLessThanEquals:
+            matches = !(right_value < left_value);
+            break;
+          case ScanType::OpGreaterThan:
+            matches = right_value < left_value;
+            break;
+          case ScanType::OpGreaterThanEquals:
+            matches = !(left_value < right_value);
+            break;
+        }
+
+        if (matches) {
+          auto row = left_row;
+          row.insert(row.end(), right_row.cbegin(), right_row.cend());
+          result->append(row);
+        }
+      }
+    }
+    return result;
+  }
+
+  static std::vector<std::vector<AllTypeVariant>> _rows(const Table& table) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (ChunkOffset offset{0}; offset < chunk.size(); ++offset) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[offset]);
+        }
+        rows.emplace_back(std::move(row));
+      }
+    }
+    return rows;
+  }
+
+  const std::vector<ScanType> _scan_types{ScanType::OpEquals,         ScanType::OpNotEquals,
+                                          ScanType::OpLessThan,       ScanType::OpLessThanEquals,
+                                          ScanType::OpGreaterThan,    ScanType::OpGreaterThanEquals};
+
+  std::shared_ptr<Table> _table_left, _table_right;
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right, _table_wrapper_left_dict;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, JoinIntColumnsEquals) {
+  auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right,
+                                              std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), load_table("src/test/tables/join_equals_int_result.tbl", 1));
+}
+
+TEST_F(OperatorsJoinSortMergeTest, AllScanTypes) {
+  const auto int_columns = std::make_pair(ColumnID{0}, ColumnID{0});
+  const auto string_columns = std::make_pair(ColumnID{2}, ColumnID{1});
+
+  for (const auto scan_type : _scan_types) {
+    for (const auto& column_ids : {int_columns, string_columns}) {
+      auto join =
+          std::make_shared<JoinSortMerge>(_table_wrapper_left_dict, _table_wrapper_right, column_ids, scan_type);
+      join->execute();
+
+      EXPECT_TABLE_EQ(join->get_output(), _nested_loop_join(*_table_left, *_table_right, column_ids, scan_type));
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{1}, ScanType::OpGreaterThan, 2.0f);
+  scan->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(scan, _table_wrapper_right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpGreaterThanEquals);
+  join->execute();
+
+  const auto expected = _nested_loop_join(*scan->get_output(), *_table_right,
+                                          std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpGreaterThanEquals);
+  EXPECT_TABLE_EQ(join->get_output(), expected);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpNotEquals);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->get_chunk(ChunkID{0}).column_count(), 5u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, ThrowsOnTypeMismatch) {
+  auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right,
+                                              std::make_pair(ColumnID{1}, ColumnID{0}), ScanType::OpLessThan);
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, ManyPartitions) {
+  // Large enough to be split into several partitions. The left input is sorted, the right one is not.
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, 10'000};
+
+  auto left_table = std::make_shared<Table>(1000);
+  left_table->add_column("a", "int");
+  for (auto value = 0; value < 20'000; ++value) {
+    left_table->append({value / 2});
+  }
+  left_table->compress_chunk(ChunkID{2});
+
+  auto right_table = std::make_shared<Table>(100);
+  right_table->add_column("b", "int");
+  auto right_values = std::vector<int32_t>{};
+  for (auto row = 0; row < 300; ++row) {
+    right_values.emplace_back(distribution(random_engine));
+    right_table->append({right_values.back()});
+  }
+  std::sort(right_values.begin(), right_values.end());
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpLessThan, ScanType::OpGreaterThanEquals}) {
+    auto join = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                                scan_type);
+    join->execute();
+
+    auto expected_row_count = size_t{0};
+    for (auto value = 0; value < 20'000; ++value) {
+      const auto lower = std::lower_bound(right_values.cbegin(), right_values.cend(), value / 2);
+      const auto upper = std::upper_bound(right_values.cbegin(), right_values.cend(), value / 2);
+      if (scan_type == ScanType::OpEquals) expected_row_count += std::distance(lower, upper);
+      if (scan_type == ScanType::OpLessThan) expected_row_count += std::distance(upper, right_values.cend());
+      if (scan_type == ScanType::OpGreaterThanEquals) {
+        expected_row_count += std::distance(right_values.cbegin(), upper);
+      }
+    }
+    EXPECT_EQ(join->get_output()->row_count(), expected_row_count);
+  }
+}
+
+}  // namespace opossum
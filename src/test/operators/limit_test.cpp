@@ -0,0 +1,82 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/sort_input.tbl", 3);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns a table with the first row_count rows of table
+  static std::shared_ptr<Table> _first_rows(const Table& table, const size_t row_count) {
+    auto result = std::make_shared<Table>();
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      result->add_column(table.column_name(column_id), table.column_type(column_id));
+    }
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count() && result->row_count() < row_count; ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (ChunkOffset offset{0}; offset < chunk.size() && result->row_count() < row_count; ++offset) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[offset]);
+        }
+        result->append(row);
+      }
+    }
+    return result;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, FirstRows) {
+  for (const auto row_count : {1u, 3u, 4u, 8u, 100u}) {
+    auto limit = std::make_shared<Limit>(_table_wrapper, row_count);
+    limit->execute();
+    EXPECT_TABLE_EQ(limit->get_output(), _first_rows(*_table, row_count), true);
+  }
+}
+
+TEST_F(OperatorsLimitTest, OnlyAccessesRequiredChunks) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 4);
+  limit->execute();
+
+  const auto output = limit->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).size(), 3u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).size(), 1u);
+}
+
+TEST_F(OperatorsLimitTest, ReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  scan->execute();
+
+  auto limit = std::make_shared<Limit>(scan, 3);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), _first_rows(*scan->get_output(), 3), true);
+}
+
+TEST_F(OperatorsLimitTest, NoRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+
+  EXPECT_EQ(limit->get_output()->row_count(), 0u);
+  EXPECT_EQ(limit->get_output()->column_count(), 3u);
+}
+
+}  // namespace opossum
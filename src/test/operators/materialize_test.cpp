@@ -0,0 +1,115 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/materialize.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // chunks 0 and 1 are dictionary-encoded, chunk 2 is not
+    _table = load_table("src/test/tables/sort_input.tbl", 3);
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<const Table> _materialize(const std::shared_ptr<const AbstractOperator>& in) {
+    auto materialize = std::make_shared<Materialize>(in);
+    materialize->execute();
+    return materialize->get_output();
+  }
+
+  static bool _has_only_value_segments(const Table& table) {
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+        const auto segment = chunk.get_segment(column_id);
+        if (!std::dynamic_pointer_cast<ValueSegment<int32_t>>(segment) &&
+            !std::dynamic_pointer_cast<ValueSegment<float>>(segment) &&
+            !std::dynamic_pointer_cast<ValueSegment<std::string>>(segment)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMaterializeTest, DecodesDictionariesAndForwardsValueSegments) {
+  const auto output = _materialize(_table_wrapper);
+
+  EXPECT_TRUE(_has_only_value_segments(*output));
+  EXPECT_TABLE_EQ(output, _table, true);
+  ASSERT_EQ(output->chunk_count(), 3u);
+  EXPECT_EQ(output->get_chunk(ChunkID{2}).get_segment(ColumnID{2}),
+            _table->get_chunk(ChunkID{2}).get_segment(ColumnID{2}));
+}
+
+TEST_F(OperatorsMaterializeTest, GathersReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}});
+  sort->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{scan, sort}) {
+    const auto output = _materialize(input);
+    EXPECT_TRUE(_has_only_value_segments(*output));
+    EXPECT_TABLE_EQ(output, input->get_output(), true);
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, LongRuns) {
+  // long runs of positions per chunk: gap-free ones (Limit) and reversed ones (Sort), which are gathered with
+  // prefetching
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto value = 0; value < 1000; ++value) {
+    table->append({value, std::to_string(value % 7)});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+    table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto limit = std::make_shared<Limit>(table_wrapper, 950);
+  limit->execute();
+  auto sort = std::make_shared<Sort>(limit, std::vector{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}});
+  sort->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{limit, sort}) {
+    const auto output = _materialize(input);
+    EXPECT_TRUE(_has_only_value_segments(*output));
+    EXPECT_TABLE_EQ(output, input->get_output(), true);
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  const auto output = _materialize(scan);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->column_count(), 3u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,162 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/join_semi.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    _table->add_column("c", "string");
+    for (auto row = 0; row < 1000; ++row) {
+      _table->append({row, row % 7, std::string(1, static_cast<char>('a' + row % 5))});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < 5; ++chunk_id) {
+      _table->compress_chunk(chunk_id);
+    }
+  }
+
+  // The plans are created twice, as operators can only be executed once
+  std::shared_ptr<TableWrapper> _table_wrapper() const { return std::make_shared<TableWrapper>(_table); }
+
+  // a + 2 * b and c for the rows with a >= 150
+  std::shared_ptr<Projection> _scan_and_project() const {
+    const auto scan = std::make_shared<TableScan>(_table_wrapper(), ColumnID{0}, ScanType::OpGreaterThanEquals, 150);
+    const auto product = std::make_shared<ArithmeticExpression>(
+        ArithmeticOperator::Multiplication, std::make_shared<ValueExpression>(2),
+        std::make_shared<ColumnExpression>(ColumnID{1}));
+    const auto sum = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition,
+                                                            std::make_shared<ColumnExpression>(ColumnID{0}), product);
+    return std::make_shared<Projection>(
+        scan, std::vector<std::shared_ptr<AbstractExpression>>{sum, std::make_shared<ColumnExpression>(ColumnID{2})});
+  }
+
+  static void _execute_operator_by_operator(const std::shared_ptr<AbstractOperator>& op) {
+    for (const auto& input : {op->input_left(), op->input_right()}) {
+      if (input) _execute_operator_by_operator(std::const_pointer_cast<AbstractOperator>(input));
+    }
+    op->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsPipelineTest, ScanProjectAggregate) {
+  const auto create_plan = [&]() {
+    const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                                                   {std::nullopt, AggregateFunction::Count}};
+    return std::make_shared<Aggregate>(_scan_and_project(), aggregates, std::vector{ColumnID{1}});
+  };
+
+  const auto expected = create_plan();
+  _execute_operator_by_operator(expected);
+
+  const auto aggregate = create_plan();
+  execute_pipelined(aggregate);
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected->get_output());
+
+  // The intermediate results are never materialized
+  EXPECT_EQ(aggregate->input_left()->get_output(), nullptr);
+  EXPECT_EQ(aggregate->input_left()->input_left()->get_output(), nullptr);
+}
+
+TEST_F(OperatorsPipelineTest, ComputedColumnsAreMaterialized) {
+  // The scan references the results of the projection, which only exist while each chunk is processed
+  const auto create_plan = [&]() {
+    const auto scan = std::make_shared<TableScan>(_scan_and_project(), ColumnID{0}, ScanType::OpLessThan, 500);
+    return std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{0}}});
+  };
+
+  const auto expected = create_plan();
+  _execute_operator_by_operator(expected);
+
+  const auto sort = create_plan();
+  execute_pipelined(sort);
+
+  EXPECT_TABLE_EQ(sort->get_output(), expected->get_output(), true);
+
+  const auto& scan_output = sort->input_left()->get_output();
+  ASSERT_NE(scan_output, nullptr);
+  EXPECT_GT(scan_output->chunk_count(), 1u);
+  for (ChunkID chunk_id{0}; chunk_id < scan_output->chunk_count(); ++chunk_id) {
+    const auto& chunk = scan_output->get_chunk(chunk_id);
+    EXPECT_FALSE(std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0})));
+
+    // Forwarded columns still reference the stored table
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{1}));
+    ASSERT_NE(reference_segment, nullptr);
+    EXPECT_EQ(reference_segment->referenced_table(), _table);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, SemiJoinProbe) {
+  const auto create_plan = [&]() {
+    const auto right = std::make_shared<TableScan>(_table_wrapper(), ColumnID{0}, ScanType::OpLessThan, 3);
+    const auto left = std::make_shared<TableScan>(_table_wrapper(), ColumnID{2}, ScanType::OpNotEquals, "a");
+    return std::make_shared<JoinSemi>(left, right, std::make_pair(ColumnID{1}, ColumnID{0}), SemiJoinMode::Semi);
+  };
+
+  const auto expected = create_plan();
+  _execute_operator_by_operator(expected);
+
+  const auto join = create_plan();
+  execute_pipelined(join);
+
+  EXPECT_TABLE_EQ(join->get_output(), expected->get_output());
+  EXPECT_NE(join->input_right()->get_output(), nullptr);
+  EXPECT_EQ(join->input_left()->get_output(), nullptr);
+}
+
+TEST_F(OperatorsPipelineTest, EmptyResult) {
+  const auto scan = std::make_shared<TableScan>(_scan_and_project(), ColumnID{0}, ScanType::OpLessThan, 0);
+  execute_pipelined(scan);
+
+  const auto& output = scan->get_output();
+  EXPECT_EQ(output->row_count(), 0u);
+  ASSERT_EQ(output->chunk_count(), 1u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).column_count(), 2u);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "c");
+}
+
+TEST_F(OperatorsPipelineTest, ChunksStayOnTheirNodes) {
+  Topology::get().use_fake_numa_topology(2, 2);
+  _table->set_chunk_node_affinity([](const ChunkID chunk_id) { return chunk_id < 5 ? NodeID{0} : NodeID{1}; });
+  CurrentScheduler::set(std::make_shared<Scheduler>());
+
+  const auto scan = std::make_shared<TableScan>(_table_wrapper(), ColumnID{1}, ScanType::OpEquals, 3);
+  execute_pipelined(scan);
+  CurrentScheduler::get()->finish();
+
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), _table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id).node_id(), _table->get_chunk(chunk_id).node_id());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,216 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/cast_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/comparison_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/projection_input.tbl", 2);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+
+    auto table_dict = load_table("src/test/tables/projection_input.tbl", 2);
+    table_dict->compress_chunk(ChunkID{0});
+    table_dict->compress_chunk(ChunkID{1});
+    _table_wrapper_dict = std::make_shared<TableWrapper>(table_dict);
+    _table_wrapper_dict->execute();
+  }
+
+  static std::shared_ptr<AbstractExpression> _column(const ColumnID column_id) {
+    return std::make_shared<ColumnExpression>(column_id);
+  }
+
+  static std::shared_ptr<AbstractExpression> _value(const AllTypeVariant& value) {
+    return std::make_shared<ValueExpression>(value);
+  }
+
+  static std::shared_ptr<AbstractExpression> _arithmetic(const ArithmeticOperator arithmetic_operator,
+                                                        const std::shared_ptr<AbstractExpression>& left,
+                                                        const std::shared_ptr<AbstractExpression>& right) {
+    return std::make_shared<ArithmeticExpression>(arithmetic_operator, left, right);
+  }
+
+  static std::shared_ptr<AbstractExpression> _comparison(const ScanType scan_type,
+                                                        const std::shared_ptr<AbstractExpression>& left,
+                                                        const std::shared_ptr<AbstractExpression>& right) {
+    return std::make_shared<ComparisonExpression>(scan_type, left, right);
+  }
+
+  static std::shared_ptr<const Table> _project(const std::shared_ptr<const AbstractOperator>& in,
+                                               const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+    auto projection = std::make_shared<Projection>(in, expressions);
+    projection->execute();
+    return projection->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsProjectionTest, DiscountedPrice) {
+  // price * (1 - discount)
+  const auto discounted_price =
+      _arithmetic(ArithmeticOperator::Multiplication, _column(ColumnID{1}),
+                  _arithmetic(ArithmeticOperator::Subtraction, _value(1), _column(ColumnID{2})));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("price * (1 - discount)", "double");
+  for (const auto value : {5.0, 15.0, 8.0, 1.0}) {
+    expected->append({value});
+  }
+
+  EXPECT_TABLE_EQ(_project(_table_wrapper, {discounted_price}), expected, true);
+  EXPECT_TABLE_EQ(_project(_table_wrapper_dict, {discounted_price}), expected, true);
+
+  // reference segments to rows 0, 1, and 2 of the dictionary-encoded table
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  scan->execute();
+
+  auto expected_scan = std::make_shared<Table>();
+  expected_scan->add_column("price * (1 - discount)", "double");
+  for (const auto value : {5.0, 15.0, 8.0}) {
+    expected_scan->append({value});
+  }
+  EXPECT_TABLE_EQ(_project(scan, {discounted_price}), expected_scan, true);
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsColumnSegments) {
+  const auto output = _project(_table_wrapper_dict, {_column(ColumnID{3}), _column(ColumnID{0})});
+
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"name", "a"}));
+  ASSERT_EQ(output->chunk_count(), 2u);
+  const auto& input_table = *_table_wrapper_dict->get_output();
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id).get_segment(ColumnID{0}),
+              input_table.get_chunk(chunk_id).get_segment(ColumnID{3}));
+    EXPECT_EQ(output->get_chunk(chunk_id).get_segment(ColumnID{1}),
+              input_table.get_chunk(chunk_id).get_segment(ColumnID{0}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, IntegerArithmeticAndTypePromotion) {
+  const auto a = _column(ColumnID{0});
+  const auto price = _column(ColumnID{1});
+  const auto output = _project(_table_wrapper, {_arithmetic(ArithmeticOperator::Addition, a, _value(1)),
+                                                _arithmetic(ArithmeticOperator::Multiplication, a, _value(int64_t{2})),
+                                                _arithmetic(ArithmeticOperator::Division, a, _value(2)),
+                                                _arithmetic(ArithmeticOperator::Modulo, a, _value(3)),
+                                                _arithmetic(ArithmeticOperator::Modulo, price, _value(3))});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a + 1", "int");
+  expected->add_column("a * 2", "long");
+  expected->add_column("a / 2", "int");
+  expected->add_column("a % 3", "int");
+  expected->add_column("price % 3", "float");
+  expected->append({2, int64_t{2}, 0, 1, 1.0f});
+  expected->append({5, int64_t{8}, 2, 1, 2.0f});
+  expected->append({1, int64_t{0}, 0, 0, 2.0f});
+  expected->append({-2, int64_t{-6}, -1, 0, 1.0f});
+
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, Casts) {
+  const auto output = _project(_table_wrapper_dict, {std::make_shared<CastExpression>(_column(ColumnID{0}), "string"),
+                                                     std::make_shared<CastExpression>(_column(ColumnID{1}), "int"),
+                                                     std::make_shared<CastExpression>(_value("42"), "long")});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("CAST(a AS string)", "string");
+  expected->add_column("CAST(price AS int)", "int");
+  expected->add_column("CAST('42' AS long)", "long");
+  expected->append({"1", 10, int64_t{42}});
+  expected->append({"4", 20, int64_t{42}});
+  expected->append({"0", 8, int64_t{42}});
+  expected->append({"-3", 4, int64_t{42}});
+
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, Comparisons) {
+  const auto output =
+      _project(_table_wrapper_dict, {_comparison(ScanType::OpGreaterThan, _column(ColumnID{0}), _value(0)),
+                                     _comparison(ScanType::OpEquals, _column(ColumnID{3}), _value("banana")),
+                                     _comparison(ScanType::OpLessThan, _column(ColumnID{2}), _column(ColumnID{0}))});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a > 0", "int");
+  expected->add_column("name = 'banana'", "int");
+  expected->add_column("discount < a", "int");
+  expected->append({1, 0, 1});
+  expected->append({1, 1, 1});
+  expected->append({0, 0, 0});
+  expected->append({0, 0, 0});
+
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, CaseEvaluatesBranchesOnlyForSelectedRows) {
+  // CASE WHEN a <> 0 THEN 12 / a ELSE -1 END must not divide by zero for the third row
+  const auto case_expression = std::make_shared<CaseExpression>(
+      _comparison(ScanType::OpNotEquals, _column(ColumnID{0}), _value(0)),
+      _arithmetic(ArithmeticOperator::Division, _value(12), _column(ColumnID{0})), _value(-1));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("CASE WHEN a <> 0 THEN 12 / a ELSE -1 END", "int");
+  for (const auto value : {12, 3, -1, -4}) {
+    expected->append({value});
+  }
+
+  EXPECT_TABLE_EQ(_project(_table_wrapper, {case_expression}), expected, true);
+  EXPECT_TABLE_EQ(_project(_table_wrapper_dict, {case_expression}), expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, CaseWithColumnAsCondition) {
+  // The condition is a double column, whose values the evaluator references instead of copying them
+  const auto case_expression =
+      std::make_shared<CaseExpression>(_column(ColumnID{2}), _column(ColumnID{0}), _value(100));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("CASE WHEN discount THEN a ELSE 100 END", "int");
+  for (const auto value : {1, 4, 100, -3}) {
+    expected->append({value});
+  }
+
+  EXPECT_TABLE_EQ(_project(_table_wrapper, {case_expression}), expected, true);
+  EXPECT_TABLE_EQ(_project(_table_wrapper_dict, {case_expression}), expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, ThrowsOnInvalidExpressions) {
+  EXPECT_THROW(_project(_table_wrapper, {_arithmetic(ArithmeticOperator::Addition, _column(ColumnID{0}),
+                                                     _column(ColumnID{3}))}),
+               std::logic_error);
+  EXPECT_THROW(_project(_table_wrapper, {_comparison(ScanType::OpEquals, _column(ColumnID{3}), _value(1))}),
+               std::logic_error);
+  EXPECT_THROW(_project(_table_wrapper, {_column(ColumnID{4})}), std::logic_error);
+  EXPECT_THROW(_project(_table_wrapper, {_arithmetic(ArithmeticOperator::Division, _value(1), _column(ColumnID{0}))}),
+               std::logic_error);
+  for (const auto arithmetic_operator : {ArithmeticOperator::Division, ArithmeticOperator::Modulo}) {
+    EXPECT_THROW(_project(_table_wrapper, {_arithmetic(arithmetic_operator, _value(std::numeric_limits<int32_t>::min()),
+                                                       _value(-1))}),
+                 std::logic_error);
+  }
+  EXPECT_THROW(_project(_table_wrapper, {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/sort_input.tbl", 3));
+    _table_wrapper->execute();
+
+    auto table_dict = load_table("src/test/tables/sort_input.tbl", 3);
+    table_dict->compress_chunk(ChunkID{0});
+    table_dict->compress_chunk(ChunkID{1});
+    _table_wrapper_dict = std::make_shared<TableWrapper>(table_dict);
+    _table_wrapper_dict->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsSortTest, SingleColumnAscending) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}}});
+  sort->execute();
+
+  EXPECT_TABLE_EQ(sort->get_output(), load_table("src/test/tables/sort_a_asc_result.tbl", 3), true);
+}
+
+TEST_F(OperatorsSortTest, MultipleColumnsWithDescending) {
+  const auto definitions = std::vector{SortColumnDefinition{ColumnID{2}, OrderByMode::Descending},
+                                       SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}};
+  const auto expected = load_table("src/test/tables/sort_c_desc_a_asc_result.tbl", 3);
+
+  for (const auto& input : {_table_wrapper, _table_wrapper_dict}) {
+    auto sort = std::make_shared<Sort>(input, definitions);
+    sort->execute();
+    EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+  }
+}
+
+TEST_F(OperatorsSortTest, FloatsAndReferenceSegments) {
+  // Negative numbers, 0.0 and -0.0, and equal values that have to keep their input order
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, ScanType::OpLessThan, 100);
+  scan->execute();
+
+  auto sort = std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{1}}});
+  sort->execute();
+
+  const auto output = sort->get_output();
+  EXPECT_TABLE_EQ(output, load_table("src/test/tables/sort_b_asc_result.tbl", 3), true);
+
+  // The output references the table that stores the data, not the output of the scan
+  const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+      output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper_dict->get_output());
+}
+
+TEST_F(OperatorsSortTest, WideKeysAndManyRows) {
+  // Enough rows to be sorted in parallel and keys that span more than four words
+  auto random_engine = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int64_t>{-50, 50};
+
+  auto table = std::make_shared<Table>(1000);
+  auto definitions = std::vector<SortColumnDefinition>{};
+  for (auto column_index = 0; column_index < 5; ++column_index) {
+    table->add_column("l" + std::to_string(column_index), "long");
+    definitions.emplace_back(ColumnID{static_cast<ColumnID::base_type>(column_index)},
+                             column_index % 2 ? OrderByMode::Descending : OrderByMode::Ascending);
+  }
+  table->add_column("d", "double");
+  definitions.emplace_back(ColumnID{5});
+
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (auto row = 0; row < 20'000; ++row) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto column_index = 0; column_index < 5; ++column_index) {
+      values.emplace_back(distribution(random_engine) / 40);
+    }
+    values.emplace_back(static_cast<double>(distribution(random_engine)) / 3.0);
+    table->append(values);
+    rows.emplace_back(std::move(values));
+  }
+
+  auto expected = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    expected->add_column(table->column_name(column_id), table->column_type(column_id));
+  }
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+    for (auto index = size_t{0}; index < lhs.size(); ++index) {
+      if (lhs[index] == rhs[index]) continue;
+      return index % 2 && index < 5 ? rhs[index] < lhs[index] : lhs[index] < rhs[index];
+    }
+    return false;
+  });
+  for (const auto& row : rows) {
+    expected->append(row);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, definitions);
+  sort->execute();
+
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto sort = std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{2}}});
+  sort->execute();
+
+  EXPECT_EQ(sort->get_output()->row_count(), 0u);
+  EXPECT_EQ(sort->get_output()->column_count(), 3u);
+}
+
+TEST_F(OperatorsSortTest, InvalidSortColumns) {
+  EXPECT_THROW(std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{}), std::logic_error);
+
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector{SortColumnDefinition{ColumnID{3}}});
+  EXPECT_THROW(sort->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -274,6 +274,27 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, OutputPosListsHaveGuarantees) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 4);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 120);
+  scan_2->execute();
+
+  for (const auto& scan : {scan_1, scan_2}) {
+    const auto& output = scan->get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment =
+          std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id).get_segment(ColumnID{0}));
+      ASSERT_TRUE(segment);
+      EXPECT_TRUE(segment->pos_list()->references_single_chunk());
+      EXPECT_TRUE(segment->pos_list()->is_sorted());
+    }
+  }
+
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {6, 8, 10, 12, 14, 16, 18});
+}
+
 TEST_F(OperatorsTableScanTest, UnknownScanTypeShouldThrow) {
   // 2**8 + 1 values require a data type of 16bit.
   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
@@ -0,0 +1,95 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/sort_input.tbl", 3));
+    _table_wrapper->execute();
+
+    auto table_dict = load_table("src/test/tables/sort_input.tbl", 3);
+    table_dict->compress_chunk(ChunkID{0});
+    table_dict->compress_chunk(ChunkID{1});
+    _table_wrapper_dict = std::make_shared<TableWrapper>(table_dict);
+    _table_wrapper_dict->execute();
+  }
+
+  // The output of TopK has to be equal to the first rows of a Sort
+  void _expect_sort_and_limit(const std::shared_ptr<const AbstractOperator>& input,
+                              const SortColumnDefinition& definition, const uint64_t row_count) {
+    auto top_k = std::make_shared<TopK>(input, definition, row_count);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, std::vector{definition});
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, row_count);
+    limit->execute();
+
+    EXPECT_TABLE_EQ(top_k->get_output(), limit->get_output(), true);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsTopKTest, AllColumnsAndModes) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, ScanType::OpNotEquals, 2);
+  scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{_table_wrapper, _table_wrapper_dict,
+                                                                               scan}) {
+    for (ColumnID column_id{0}; column_id < 3; ++column_id) {
+      for (const auto mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+        for (const auto row_count : {1u, 2u, 5u, 20u}) {
+          _expect_sort_and_limit(input, SortColumnDefinition{column_id, mode}, row_count);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksWithTies) {
+  // Many dictionary-encoded chunks with few distinct values, so that most chunks can be skipped and ties have to be
+  // resolved by the input order
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto row = 0; row < 1000; ++row) {
+    table->append({(row * 37) % 11, row});
+  }
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    for (const auto row_count : {1u, 7u, 95u, 500u}) {
+      _expect_sort_and_limit(table_wrapper, SortColumnDefinition{ColumnID{0}, mode}, row_count);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, NoRows) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, SortColumnDefinition{ColumnID{0}}, 0);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+
+  auto invalid_top_k = std::make_shared<TopK>(_table_wrapper, SortColumnDefinition{ColumnID{5}}, 3);
+  EXPECT_THROW(invalid_top_k->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsUnionAllTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/sort_input.tbl", 3);
+    _table->compress_chunk(ChunkID{0});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionAllTest, ConcatenatesChunksWithoutCopying) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpEquals, "alpha");
+  scan->execute();
+
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, scan);
+  union_all->execute();
+  const auto output = union_all->get_output();
+
+  EXPECT_EQ(output->row_count(), 8u + 3u);
+  ASSERT_EQ(output->chunk_count(), _table->chunk_count() + scan->get_output()->chunk_count());
+  for (ColumnID column_id{0}; column_id < output->column_count(); ++column_id) {
+    EXPECT_EQ(output->get_chunk(ChunkID{1}).get_segment(column_id),
+              _table->get_chunk(ChunkID{1}).get_segment(column_id));
+    EXPECT_EQ(output->get_chunk(_table->chunk_count()).get_segment(column_id),
+              scan->get_output()->get_chunk(ChunkID{0}).get_segment(column_id));
+  }
+
+  auto expected = load_table("src/test/tables/sort_input.tbl", 3);
+  expected->append({-1, -2.0f, "alpha"});
+  expected->append({10, -3.5f, "alpha"});
+  expected->append({3, -2.0f, "alpha"});
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsUnionAllTest, ScanOverScansOfDifferentTables) {
+  auto other_table = std::make_shared<Table>(2);
+  other_table->add_column("a", "int");
+  other_table->add_column("b", "float");
+  other_table->add_column("c", "string");
+  other_table->append({4, 8.0f, "alpha"});
+  other_table->append({5, 9.0f, "foxtrot"});
+  other_table->append({6, 1.0f, "alpha"});
+  auto other_wrapper = std::make_shared<TableWrapper>(other_table);
+  other_wrapper->execute();
+
+  auto scan_left = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpEquals, "alpha");
+  scan_left->execute();
+  auto scan_right = std::make_shared<TableScan>(other_wrapper, ColumnID{2}, ScanType::OpEquals, "alpha");
+  scan_right->execute();
+
+  // The output of the union references two different tables, the second union also mixes in stored data
+  for (const auto& right_input : std::vector<std::shared_ptr<AbstractOperator>>{scan_right, other_wrapper}) {
+    auto union_all = std::make_shared<UnionAll>(scan_left, right_input);
+    union_all->execute();
+
+    auto scan = std::make_shared<TableScan>(union_all, ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+    scan->execute();
+    // Unlike the scan, the sort outputs positions of several input chunks at once
+    auto sort = std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{0}}});
+    sort->execute();
+
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "float");
+    expected->add_column("c", "string");
+    expected->append({3, -2.0f, "alpha"});
+    expected->append({4, 8.0f, "alpha"});
+    if (right_input == other_wrapper) expected->append({5, 9.0f, "foxtrot"});
+    expected->append({6, 1.0f, "alpha"});
+    expected->append({10, -3.5f, "alpha"});
+    EXPECT_TABLE_EQ(scan->get_output(), expected);
+    EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+  }
+}
+
+TEST_F(OperatorsUnionAllTest, EmptyInputs) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto union_all = std::make_shared<UnionAll>(scan, scan);
+  union_all->execute();
+
+  EXPECT_EQ(union_all->get_output()->row_count(), 0u);
+  EXPECT_EQ(union_all->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(OperatorsUnionAllTest, ThrowsOnDifferentColumns) {
+  auto other_table = load_table("src/test/tables/int_float.tbl", 2);
+  auto other_wrapper = std::make_shared<TableWrapper>(other_table);
+  other_wrapper->execute();
+
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, other_wrapper);
+  EXPECT_THROW(union_all->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsUnionPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/sort_input.tbl", 3);
+    _table->compress_chunk(ChunkID{0});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<const Table> _union(const std::shared_ptr<const AbstractOperator>& left,
+                                             const std::shared_ptr<const AbstractOperator>& right) {
+    auto union_positions = std::make_shared<UnionPositions>(left, right);
+    union_positions->execute();
+    return union_positions->get_output();
+  }
+
+  static std::shared_ptr<TableScan> _scan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                          const ScanType scan_type, const AllTypeVariant& value) {
+    auto scan = std::make_shared<TableScan>(in, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  static std::shared_ptr<TableWrapper> _int_table(const ChunkOffset chunk_size, const int32_t row_count) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", "int");
+    for (auto value = 0; value < row_count; ++value) {
+      table->append({value});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionPositionsTest, Disjunction) {
+  // a < 3 OR c = 'alpha'
+  const auto output = _union(_scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3),
+                             _scan(_table_wrapper, ColumnID{2}, ScanType::OpEquals, "alpha"));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "float");
+  expected->add_column("c", "string");
+  expected->append({-1, -2.0f, "alpha"});
+  expected->append({2, -0.0f, "charlie"});
+  expected->append({-1, 7.25f, "echo"});
+  expected->append({10, -3.5f, "alpha"});
+  expected->append({2, 1.5f, "bravo"});
+  expected->append({3, -2.0f, "alpha"});
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsUnionPositionsTest, RemovesDuplicatesOfUnsortedInputs) {
+  // the sorted input lists the rows out of order, and both inputs contain the row (10, -3.5, alpha)
+  auto sort = std::make_shared<Sort>(_scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2),
+                                     std::vector{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}});
+  sort->execute();
+  const auto output = _union(sort, _scan(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, -3.0f));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "float");
+  expected->add_column("c", "string");
+  expected->append({3, 1.5f, "delta"});
+  expected->append({3, 0.0f, "bravo"});
+  expected->append({10, -3.5f, "alpha"});
+  expected->append({3, -2.0f, "alpha"});
+  EXPECT_TABLE_EQ(output, expected, true);
+}
+
+TEST_F(OperatorsUnionPositionsTest, DenseAndSparsePositions) {
+  // dense positions are deduplicated with a bitmap
+  const auto dense_table_wrapper = _int_table(100, 1000);
+  const auto dense_output = _union(_scan(dense_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 600),
+                                   _scan(dense_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 400));
+  EXPECT_TABLE_EQ(dense_output, dense_table_wrapper->get_output(), true);
+  EXPECT_EQ(dense_output->chunk_count(), 10u);
+
+  // sparse positions are sorted
+  const auto sparse_table_wrapper = _int_table(1000, 2000);
+  const auto sparse_output = _union(_scan(sparse_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 20),
+                                    _scan(sparse_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10));
+  const auto expected = _int_table(1000, 20);
+  EXPECT_TABLE_EQ(sparse_output, expected->get_output(), true);
+}
+
+TEST_F(OperatorsUnionPositionsTest, EmptyInputs) {
+  const auto empty_scan = _scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  EXPECT_EQ(_union(empty_scan, empty_scan)->row_count(), 0u);
+
+  const auto output = _union(empty_scan, _scan(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 10));
+  EXPECT_EQ(output->row_count(), 1u);
+}
+
+TEST_F(OperatorsUnionPositionsTest, ThrowsOnInvalidInputs) {
+  const auto scan = _scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3);
+  EXPECT_THROW(_union(scan, _table_wrapper), std::logic_error);
+
+  // same columns, but a different referenced table
+  auto other_table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/sort_input.tbl", 3));
+  other_table_wrapper->execute();
+  EXPECT_THROW(_union(scan, _scan(other_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 3)), std::logic_error);
+}
+
+}  // namespace opossum
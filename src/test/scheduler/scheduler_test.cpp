@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/table.hpp"
+#include "utils/execute_in_parallel.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {
+ protected:
+  // Creates a task that records its name in _execution_order
+  std::shared_ptr<AbstractTask> _recording_task(const char name) {
+    return std::make_shared<JobTask>([this, name]() {
+      std::lock_guard lock(_mutex);
+      _execution_order.emplace_back(name);
+    });
+  }
+
+  std::mutex _mutex;
+  std::vector<char> _execution_order;
+};
+
+TEST_F(SchedulerTest, ExecutesImmediatelyWithoutScheduler) {
+  auto executed = false;
+  const auto predecessor = std::make_shared<JobTask>([]() {});
+  const auto task = std::make_shared<JobTask>([&]() { executed = true; });
+  predecessor->set_as_predecessor_of(task);
+
+  task->schedule();
+  EXPECT_FALSE(task->is_ready());
+  EXPECT_FALSE(executed);
+
+  predecessor->schedule();
+  EXPECT_TRUE(executed);
+  EXPECT_TRUE(task->is_done());
+}
+
+TEST_F(SchedulerTest, DependenciesDetermineOrder) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  // a diamond: first -> (left, right) -> last
+  const auto first = _recording_task('f');
+  const auto left = _recording_task('l');
+  const auto right = _recording_task('r');
+  const auto last = _recording_task('x');
+  first->set_as_predecessor_of(left);
+  first->set_as_predecessor_of(right);
+  left->set_as_predecessor_of(last);
+  right->set_as_predecessor_of(last);
+
+  // scheduled in reverse order, so that the dependencies have to hold back the successors
+  CurrentScheduler::schedule_and_wait_for_tasks({last, right, left, first});
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(_execution_order.size(), 4u);
+  EXPECT_EQ(_execution_order.front(), 'f');
+  EXPECT_EQ(_execution_order.back(), 'x');
+}
+
+TEST_F(SchedulerTest, IndependentTasksRunConcurrently) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  // Each task waits for the other one to start, which only happens if both run at the same time
+  auto started_count = std::atomic<uint32_t>{0};
+  auto met_count = std::atomic<uint32_t>{0};
+  const auto meet = [&]() {
+    ++started_count;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (started_count < 2 && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+    if (started_count == 2) ++met_count;
+  };
+
+  CurrentScheduler::schedule_and_wait_for_tasks({std::make_shared<JobTask>(meet), std::make_shared<JobTask>(meet)});
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(met_count, 2u);
+}
+
+TEST_F(SchedulerTest, IdleWorkersStealSubTasks) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  // All sub-tasks are enqueued to the queue of the worker that creates them
+  auto worker_ids = std::set<WorkerID>{};
+  const auto task = std::make_shared<JobTask>([&]() {
+    auto sub_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = 0; index < 100; ++index) {
+      sub_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        std::lock_guard lock(_mutex);
+        worker_ids.emplace(Worker::get_this_thread_worker()->id());
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(sub_tasks);
+  });
+
+  CurrentScheduler::schedule_and_wait_for_tasks({task});
+  CurrentScheduler::get()->finish();
+
+  EXPECT_GT(worker_ids.size(), 1u);
+}
+
+TEST_F(SchedulerTest, WaitingWorkersSleep) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  // The first worker sleeps in a long task, the second one waits for it without having anything else to do
+  auto is_started = std::atomic<bool>{false};
+  const auto long_task = std::make_shared<JobTask>([&]() {
+    is_started = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds{300});
+  });
+  long_task->schedule();
+  while (!is_started) std::this_thread::yield();
+
+  const auto cpu_time_before = std::clock();
+  const auto waiting_task = std::make_shared<JobTask>([&]() { CurrentScheduler::wait_for_tasks({long_task}); });
+  waiting_task->schedule();
+  waiting_task->join();
+  const auto cpu_time = static_cast<double>(std::clock() - cpu_time_before) / CLOCKS_PER_SEC;
+  CurrentScheduler::get()->finish();
+
+  EXPECT_TRUE(long_task->is_done());
+  EXPECT_LT(cpu_time, 0.1);
+}
+
+TEST_F(SchedulerTest, NestedParallelExecution) {
+  // A single worker must not block while it waits for the jobs it created
+  CurrentScheduler::set(std::make_shared<Scheduler>(1));
+
+  auto sum = std::atomic<uint32_t>{0};
+  const auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::function<void()>>{};
+    for (auto index = 0u; index < 10; ++index) {
+      jobs.emplace_back([&, index]() { execute_in_parallel({[&, index]() { sum += index; }, [&]() { sum += 1; }}); });
+    }
+    execute_in_parallel(jobs);
+  });
+
+  CurrentScheduler::schedule_and_wait_for_tasks({task});
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(sum, 45u + 10u);
+}
+
+TEST_F(SchedulerTest, RethrowsExceptions) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  auto successor_executed = false;
+  const auto failing_task = std::make_shared<JobTask>([]() { throw std::logic_error("failed"); });
+  const auto successor = std::make_shared<JobTask>([&]() { successor_executed = true; });
+  failing_task->set_as_predecessor_of(successor);
+
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks({failing_task, successor}), std::logic_error);
+  EXPECT_TRUE(successor_executed);
+
+  EXPECT_THROW(execute_in_parallel({[]() {}, []() { throw std::logic_error("failed"); }}), std::logic_error);
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, NodeLocalQueues) {
+  Topology::get().use_fake_numa_topology(2, 2);
+  const auto scheduler = std::make_shared<Scheduler>();
+  CurrentScheduler::set(scheduler);
+
+  ASSERT_EQ(scheduler->workers().size(), 4u);
+  EXPECT_EQ(scheduler->workers()[1]->node_id(), 0u);
+  EXPECT_EQ(scheduler->workers()[2]->node_id(), 1u);
+
+  // Keep all workers busy, so that no task is stolen while the queues are inspected
+  auto started_count = std::atomic<uint32_t>{0};
+  auto is_released = std::atomic<bool>{false};
+  auto blocking_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 4; ++index) {
+    blocking_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      ++started_count;
+      while (!is_released) std::this_thread::yield();
+    }));
+    blocking_tasks.back()->schedule();
+  }
+  while (started_count < 4) std::this_thread::yield();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 6; ++index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    tasks.back()->set_node_id(NodeID{1});
+    tasks.back()->schedule();
+  }
+
+  EXPECT_EQ(scheduler->queues()[0]->size() + scheduler->queues()[1]->size(), 0u);
+  EXPECT_EQ(scheduler->queues()[2]->size(), 3u);
+  EXPECT_EQ(scheduler->queues()[3]->size(), 3u);
+
+  is_released = true;
+  CurrentScheduler::wait_for_tasks(blocking_tasks);
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  // Scans run one task per chunk on the node of the chunk, and their output chunks stay on that node
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 10; ++value) {
+    table->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  scan->execute();
+  scheduler->finish();
+
+  const auto& output = scan->get_output();
+  EXPECT_EQ(output->row_count(), 6u);
+  ASSERT_EQ(output->chunk_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id).node_id(), table->get_chunk(ChunkID{chunk_id + 2}).node_id());
+  }
+}
+
+TEST_F(SchedulerTest, OperatorTree) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+  const auto scan_left = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  const auto scan_right = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan, 1000.0f);
+  const auto join = std::make_shared<JoinSortMerge>(scan_left, scan_right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                                    ScanType::OpEquals);
+
+  // The table wrapper is the input of both scans, but is executed only once
+  const auto tasks = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 4u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks.front())->get_operator(), table_wrapper);
+  EXPECT_EQ(tasks.front()->successors().size(), 2u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks.back())->get_operator(), join);
+  EXPECT_TRUE(tasks.back()->successors().empty());
+
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  // The same operators, executed on the calling thread
+  const auto expected_join = std::make_shared<JoinSortMerge>(
+      std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0),
+      std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan, 1000.0f),
+      std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+  for (const auto& task : OperatorTask::make_tasks_from_operator(expected_join)) {
+    task->schedule();
+  }
+
+  EXPECT_TABLE_EQ(join->get_output(), expected_join->get_output());
+}
+
+}  // namespace opossum
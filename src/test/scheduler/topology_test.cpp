@@ -0,0 +1,63 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class TopologyTest : public BaseTest {};
+
+TEST_F(TopologyTest, DetectsMachine) {
+  const auto& topology = Topology::get();
+  EXPECT_FALSE(topology.is_fake());
+  EXPECT_GE(topology.node_count(), 1u);
+  EXPECT_GE(topology.cpu_count(), 1u);
+  for (const auto& node : topology.nodes()) {
+    EXPECT_FALSE(node.cpus.empty());
+  }
+}
+
+TEST_F(TopologyTest, SparseNodeNumbers) {
+  // Node 1 is offline and node 3 has no CPUs
+  const auto directory = std::filesystem::temp_directory_path() / "opossum_topology_test";
+  std::filesystem::remove_all(directory);
+  const auto write_file = [&](const std::string& path, const std::string& content) {
+    std::filesystem::create_directories((directory / path).parent_path());
+    std::ofstream{directory / path} << content << std::endl;
+  };
+  write_file("online", "0,2-3");
+  write_file("node0/cpulist", "0-1");
+  write_file("node2/cpulist", "4,6");
+  write_file("node3/cpulist", "");
+
+  auto& topology = Topology::get();
+  topology.use_numa_topology(directory.string());
+  std::filesystem::remove_all(directory);
+
+  ASSERT_EQ(topology.node_count(), 2u);
+  EXPECT_EQ(topology.nodes()[0].cpus, (std::vector<CpuID>{0, 1}));
+  EXPECT_EQ(topology.nodes()[1].cpus, (std::vector<CpuID>{4, 6}));
+}
+
+TEST_F(TopologyTest, FakeTopology) {
+  auto& topology = Topology::get();
+  topology.use_fake_numa_topology(2, 3);
+
+  EXPECT_TRUE(topology.is_fake());
+  ASSERT_EQ(topology.node_count(), 2u);
+  EXPECT_EQ(topology.cpu_count(), 6u);
+  EXPECT_EQ(topology.nodes()[1].cpus, (std::vector<CpuID>{3, 4, 5}));
+
+  EXPECT_THROW(topology.use_fake_numa_topology(0, 1), std::logic_error);
+
+  topology.reset();
+  EXPECT_FALSE(topology.is_fake());
+}
+
+}  // namespace opossum
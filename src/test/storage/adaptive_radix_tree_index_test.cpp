@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class AdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  // Checks lookups and the order of all offsets in an index on values against a sorted copy of the values
+  template <typename T>
+  static void _check_index(const std::vector<T>& values, const std::vector<T>& search_values) {
+    auto segment = std::make_shared<ValueSegment<T>>();
+    for (const auto& value : values) segment->append(value);
+    const auto index = AdaptiveRadixTreeIndex{{segment}};
+
+    auto expected = std::vector<std::pair<T, ChunkOffset>>{};
+    for (auto offset = ChunkOffset{0}; offset < values.size(); ++offset) {
+      expected.emplace_back(values[offset], offset);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto expected_offsets = std::vector<ChunkOffset>{};
+    for (const auto& entry : expected) {
+      expected_offsets.emplace_back(entry.second);
+    }
+    EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), expected_offsets);
+
+    const auto value_less = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    for (const auto& search_value : search_values) {
+      const auto search_entry = std::make_pair(search_value, ChunkOffset{0});
+      const auto lower = std::lower_bound(expected.cbegin(), expected.cend(), search_entry, value_less);
+      const auto upper = std::upper_bound(expected.cbegin(), expected.cend(), search_entry, value_less);
+
+      const auto expected_matches = std::vector<ChunkOffset>(expected_offsets.cbegin() + (lower - expected.cbegin()),
+                                                              expected_offsets.cbegin() + (upper - expected.cbegin()));
+      EXPECT_EQ(std::vector<ChunkOffset>(index.lower_bound({search_value}), index.upper_bound({search_value})),
+                expected_matches);
+      EXPECT_EQ(std::distance(index.cbegin(), index.lower_bound({search_value})), lower - expected.cbegin());
+      EXPECT_EQ(std::distance(index.upper_bound({search_value}), index.cend()), expected.cend() - upper);
+    }
+  }
+};
+
+TEST_F(AdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<std::string>>();
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({"a"}), index.cend());
+  EXPECT_EQ(index.prefix_range("a").first, index.prefix_range("a").second);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, SignedIntegers) {
+  // Enough distinct values for all node types. Negative values have to be ordered before positive ones.
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{-5000, 5000};
+  auto values = std::vector<int32_t>{std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 0};
+  for (auto row = 0; row < 20'000; ++row) {
+    values.emplace_back(distribution(random_engine));
+  }
+
+  _check_index<int32_t>(values, {std::numeric_limits<int32_t>::min(), -5001, -5000, -256, -1, 0, 1, 255, 256, 4999,
+                                 5001, std::numeric_limits<int32_t>::max()});
+  _check_index<int64_t>({int64_t{1} << 40, -(int64_t{1} << 40), 3, -3, 3}, {-(int64_t{1} << 40), -4, 3, 4, 1 << 30});
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, FloatingPointNumbers) {
+  _check_index<float>({2.5f, -0.0f, -2.5f, 0.0f, -100.0f, 1e-20f, 1e20f, 2.5f},
+                      {-3.0f, -2.5f, 0.0f, 1.0f, 2.5f, 1e21f});
+  _check_index<double>({-1.5, 1.5, -1e-300, 1e300, -1e300}, {-1e300, -1.0, 0.0, 1.5, 2.0});
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, Strings) {
+  // Strings that are prefixes of other strings, empty strings, and bytes with the highest bit set
+  auto values = std::vector<std::string>{"", "a", "ab", "abc", "abd", "b", "ab", "\xff", "abc\xff", "", "zz"};
+  for (auto row = 0; row < 500; ++row) {
+    values.emplace_back("shared prefix " + std::to_string((row * 37) % 211));
+  }
+  values.emplace_back(std::string("a\0b", 3));
+  values.emplace_back(std::string("a\0", 2));
+
+  _check_index<std::string>(values, {"", "a", "aa", "ab", "abc", "abcd", "abz", "b", "shared", "shared prefix 1",
+                                     "shared prefix 99", "shared prefix 990", "z", "zz", "zzz", "\xff",
+                                     std::string("a\0", 2), std::string("a\0a", 3)});
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, PrefixRange) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"apple", "banana", "application", "app", "ape", "apple", "b"}) {
+    value_segment->append(value);
+  }
+  const auto dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+  const auto index = AdaptiveRadixTreeIndex{{dictionary_segment}};
+
+  const auto matches = [&](const std::string& prefix) {
+    const auto range = index.prefix_range(prefix);
+    auto offsets = std::vector<ChunkOffset>(range.first, range.second);
+    std::sort(offsets.begin(), offsets.end());
+    return offsets;
+  };
+
+  EXPECT_EQ(matches("app"), (std::vector<ChunkOffset>{0, 2, 3, 5}));
+  EXPECT_EQ(matches("appl"), (std::vector<ChunkOffset>{0, 2, 5}));
+  EXPECT_EQ(matches("apple"), (std::vector<ChunkOffset>{0, 5}));
+  EXPECT_EQ(matches("ap"), (std::vector<ChunkOffset>{0, 2, 3, 4, 5}));
+  EXPECT_EQ(matches("b"), (std::vector<ChunkOffset>{1, 6}));
+  EXPECT_EQ(matches("banana"), (std::vector<ChunkOffset>{1}));
+  EXPECT_EQ(matches(""), (std::vector<ChunkOffset>{0, 1, 2, 3, 4, 5, 6}));
+  EXPECT_TRUE(matches("apples").empty());
+  EXPECT_TRUE(matches("c").empty());
+  EXPECT_TRUE(matches("bananas").empty());
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, CreatedForChunk) {
+  auto chunk = Chunk{};
+  auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (const auto value : {5, 3, 5, 1}) segment->append(value);
+  chunk.add_segment(segment);
+
+  const auto index = chunk.create_index<AdaptiveRadixTreeIndex>(std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(std::vector<ChunkOffset>(index->lower_bound({5}), index->upper_bound({5})),
+            (std::vector<ChunkOffset>{0, 2}));
+  EXPECT_EQ(chunk.get_indexes(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, CompositeKeys) {
+  // (tenant, user, day) with negative tenants and strings that are prefixes of each other or contain 0x00
+  auto random_engine = std::mt19937{42};
+  auto tenant_distribution = std::uniform_int_distribution<int32_t>{-3, 3};
+  auto user_distribution = std::uniform_int_distribution<int32_t>{0, 10};
+  auto day_distribution = std::uniform_int_distribution<int64_t>{0, 30};
+
+  auto chunk = Chunk{};
+  const auto tenants = std::make_shared<ValueSegment<int32_t>>();
+  const auto users = std::make_shared<ValueSegment<std::string>>();
+  const auto days = std::make_shared<ValueSegment<int64_t>>();
+  auto rows = std::vector<std::tuple<int32_t, std::string, int64_t>>{};
+  for (auto row = 0; row < 5000; ++row) {
+    // Some users start with a 0x00 byte, which takes two bytes in the key
+    auto user = std::string(user_distribution(random_engine), 'u');
+    if (user.size() % 4 == 1) user.insert(0, 1, '\0');
+    rows.emplace_back(tenant_distribution(random_engine), std::move(user), day_distribution(random_engine));
+    tenants->append(std::get<0>(rows.back()));
+    users->append(std::get<1>(rows.back()));
+    days->append(std::get<2>(rows.back()));
+  }
+  chunk.add_segment(tenants);
+  chunk.add_segment(std::make_shared<DictionarySegment<std::string>>(users));
+  chunk.add_segment(days);
+
+  const auto index = chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}, ColumnID{2}});
+
+  // all offsets are sorted by (tenant, user, day)
+  auto previous = std::optional<std::tuple<int32_t, std::string, int64_t>>{};
+  for (auto it = index->cbegin(); it != index->cend(); ++it) {
+    if (previous) {
+      EXPECT_LE(*previous, rows[*it]);
+    }
+    previous = rows[*it];
+  }
+
+  const auto expect_matches = [&](BaseIndex::Iterator begin, const BaseIndex::Iterator end, const auto& predicate) {
+    auto offsets = std::vector<ChunkOffset>(begin, end);
+    std::sort(offsets.begin(), offsets.end());
+
+    auto expected_offsets = std::vector<ChunkOffset>{};
+    for (auto offset = ChunkOffset{0}; offset < rows.size(); ++offset) {
+      if (predicate(rows[offset])) expected_offsets.emplace_back(offset);
+    }
+    EXPECT_EQ(offsets, expected_offsets);
+  };
+
+  // equality on a prefix
+  expect_matches(index->lower_bound({-2}), index->upper_bound({-2}),
+                 [](const auto& row) { return std::get<0>(row) == -2; });
+  expect_matches(index->lower_bound({1, "uu"}), index->upper_bound({1, "uu"}),
+                 [](const auto& row) { return std::get<0>(row) == 1 && std::get<1>(row) == "uu"; });
+  expect_matches(index->lower_bound({0, "", int64_t{7}}), index->upper_bound({0, "", int64_t{7}}), [](const auto& row) {
+    return std::get<0>(row) == 0 && std::get<1>(row).empty() && std::get<2>(row) == 7;
+  });
+
+  // equality on a prefix and a range on the next column
+  expect_matches(index->lower_bound({3, "uuu", int64_t{10}}), index->upper_bound({3, "uuu", int64_t{20}}),
+                 [](const auto& row) {
+                   return std::get<0>(row) == 3 && std::get<1>(row) == "uuu" && std::get<2>(row) >= 10 &&
+                          std::get<2>(row) <= 20;
+                 });
+  expect_matches(index->lower_bound({-1, "u"}), index->lower_bound({-1, "uuuu"}), [](const auto& row) {
+    return std::get<0>(row) == -1 && std::get<1>(row) >= "u" && std::get<1>(row) < "uuuu";
+  });
+  expect_matches(index->upper_bound({2}), index->cend(), [](const auto& row) { return std::get<0>(row) > 2; });
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, ThrowsOnInvalidUse) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto other_segment = std::make_shared<ValueSegment<int32_t>>();
+  other_segment->append(1);
+  EXPECT_THROW((AdaptiveRadixTreeIndex{{segment, other_segment}}), std::logic_error);
+  EXPECT_THROW((AdaptiveRadixTreeIndex{{}}), std::logic_error);
+
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  EXPECT_THROW(index.prefix_range("a"), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/b_tree/b_tree_index.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class BTreeIndexTest : public BaseTest {
+ protected:
+  // Checks lookups and the order of all offsets in index against the values of the indexed segment
+  template <typename T>
+  static void _check_index(const BaseIndex& index, const std::vector<T>& values, const std::vector<T>& search_values) {
+    auto expected = std::vector<std::pair<T, ChunkOffset>>{};
+    for (auto offset = ChunkOffset{0}; offset < values.size(); ++offset) {
+      expected.emplace_back(values[offset], offset);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    auto expected_offsets = std::vector<ChunkOffset>{};
+    for (const auto& entry : expected) {
+      expected_offsets.emplace_back(entry.second);
+    }
+    EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), expected_offsets);
+
+    for (const auto& search_value : search_values) {
+      const auto lower =
+          std::lower_bound(expected.cbegin(), expected.cend(), std::make_pair(search_value, ChunkOffset{0}));
+      const auto upper = std::upper_bound(expected.cbegin(), expected.cend(),
+                                          std::make_pair(search_value, std::numeric_limits<ChunkOffset>::max()));
+
+      const auto expected_matches = std::vector<ChunkOffset>(expected_offsets.cbegin() + (lower - expected.cbegin()),
+                                                              expected_offsets.cbegin() + (upper - expected.cbegin()));
+      EXPECT_EQ(std::vector<ChunkOffset>(index.lower_bound({search_value}), index.upper_bound({search_value})),
+                expected_matches);
+      EXPECT_EQ(std::distance(index.upper_bound({search_value}), index.cend()), expected.cend() - upper);
+    }
+  }
+};
+
+TEST_F(BTreeIndexTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto index = BTreeIndex{{segment}};
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({1}), index.cend());
+}
+
+TEST_F(BTreeIndexTest, BulkLoadedFromValueSegment) {
+  // enough rows for three levels, with many duplicates
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{-500, 500};
+  auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto row = 0; row < 20'000; ++row) {
+    segment->append(distribution(random_engine));
+  }
+
+  const auto index = BTreeIndex{{segment}};
+  _check_index<int32_t>(index, segment->values(), {-501, -500, -1, 0, 17, 499, 500, 501});
+}
+
+TEST_F(BTreeIndexTest, DictionarySegmentWithStrings) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto row = 0; row < 1000; ++row) {
+    value_segment->append("value" + std::to_string((row * 13) % 97));
+  }
+  const auto dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+
+  const auto index = BTreeIndex{{dictionary_segment}};
+  _check_index<std::string>(index, value_segment->values(), {"value0", "value13", "value96", "value", "zzz"});
+}
+
+TEST_F(BTreeIndexTest, MaintainedOnAppend) {
+  auto table = std::make_shared<Table>(100'000);
+  table->add_column("a", "float");
+  table->add_column("b", "int");
+
+  auto random_engine = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, 300};
+  for (auto row = 0; row < 100; ++row) {
+    table->append({distribution(random_engine) / 2.0f, row});
+  }
+
+  auto& chunk = table->get_chunk(ChunkID{0});
+  const auto index = chunk.create_index<BTreeIndex>({ColumnID{0}});
+
+  // ascending and descending runs of values split leaves at their ends, random values split them in the middle
+  for (auto row = 0; row < 10'000; ++row) {
+    table->append({row / 100.0f, row});
+    table->append({-row / 100.0f, row});
+    table->append({distribution(random_engine) / 2.0f, row});
+  }
+
+  const auto& values = std::static_pointer_cast<ValueSegment<float>>(chunk.get_segment(ColumnID{0}))->values();
+  _check_index<float>(*index, values, {-99.99f, -1.5f, 0.0f, 0.5f, 42.0f, 99.99f, 150.0f, 1000.0f});
+}
+
+TEST_F(BTreeIndexTest, ThrowsOnUnsupportedSegments) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  value_segment->append(1);
+  EXPECT_THROW(BTreeIndex({value_segment, value_segment}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -7,6 +8,8 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/b_tree/b_tree_index.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -51,6 +54,29 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, AppendFailsWithoutModifyingChunk) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  const auto b_tree_index = c.create_index<BTreeIndex>({ColumnID{0}});
+  const auto art_index = c.create_index<AdaptiveRadixTreeIndex>({ColumnID{1}});
+  EXPECT_TRUE(b_tree_index->supports_append());
+  EXPECT_FALSE(art_index->supports_append());
+
+  EXPECT_THROW(c.append({2, "two"}), std::logic_error);
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ(int_value_segment->size(), 3u);
+  EXPECT_EQ(string_value_segment->size(), 3u);
+  EXPECT_EQ(std::vector<ChunkOffset>(b_tree_index->cbegin(), b_tree_index->cend()),
+            (std::vector<ChunkOffset>{2, 0, 1}));
+  EXPECT_EQ(std::vector<ChunkOffset>(art_index->cbegin(), art_index->cend()), (std::vector<ChunkOffset>{2, 0, 1}));
+
+  c.remove_index(art_index);
+  c.append({2, "two"});
+  EXPECT_EQ(c.size(), 4u);
+  EXPECT_EQ(std::vector<ChunkOffset>(b_tree_index->cbegin(), b_tree_index->cend()),
+            (std::vector<ChunkOffset>{3, 2, 0, 1}));
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   c.add_segment(int_value_segment);
   c.add_segment(string_value_segment);
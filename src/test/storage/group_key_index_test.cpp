@@ -0,0 +1,100 @@
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class GroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      value_segment->append(value);
+    }
+    _dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    _index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseSegment>>{_dictionary_segment});
+  }
+
+  static std::vector<ChunkOffset> _offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> _dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> _index;
+};
+
+TEST_F(GroupKeyIndexTest, PostingsAreGroupedByValue) {
+  // apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+}
+
+TEST_F(GroupKeyIndexTest, PointLookups) {
+  EXPECT_EQ(_offsets(_index->lower_bound({"delta"}), _index->upper_bound({"delta"})),
+            (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(_offsets(_index->lower_bound({"inbox"}), _index->upper_bound({"inbox"})), (std::vector<ChunkOffset>{7}));
+
+  // values that do not occur
+  EXPECT_EQ(_index->lower_bound({"echo"}), _index->upper_bound({"echo"}));
+  EXPECT_EQ(std::distance(_index->cbegin(), _index->lower_bound({"echo"})), 5);
+  EXPECT_EQ(_index->lower_bound({"aardvark"}), _index->cbegin());
+  EXPECT_EQ(_index->lower_bound({"zulu"}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({"zulu"}), _index->cend());
+}
+
+TEST_F(GroupKeyIndexTest, RangeLookups) {
+  // "b" <= value <= "e"
+  EXPECT_EQ(_offsets(_index->lower_bound({"b"}), _index->upper_bound({"e"})), (std::vector<ChunkOffset>{5, 6, 1, 3}));
+
+  // value < "delta" and value > "frank"
+  EXPECT_EQ(_offsets(_index->cbegin(), _index->lower_bound({"delta"})), (std::vector<ChunkOffset>{4, 5, 6}));
+  EXPECT_EQ(_offsets(_index->upper_bound({"frank"}), _index->cend()), (std::vector<ChunkOffset>{0, 7}));
+}
+
+TEST_F(GroupKeyIndexTest, WideDictionary) {
+  // more than 255 distinct values require 16 bit value ids
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto row = 0; row < 3000; ++row) {
+    value_segment->append((row * 7) % 1000);
+  }
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment);
+  const auto index = GroupKeyIndex{{dictionary_segment}};
+
+  EXPECT_EQ(_offsets(index.lower_bound({700}), index.upper_bound({700})), (std::vector<ChunkOffset>{100, 1100, 2100}));
+  EXPECT_EQ(std::distance(index.lower_bound({2}), index.upper_bound({998})), 997 * 3);
+}
+
+TEST_F(GroupKeyIndexTest, AttachToChunk) {
+  auto chunk = Chunk{};
+  chunk.add_segment(_dictionary_segment);
+  chunk.add_segment(_dictionary_segment);
+
+  const auto index = chunk.create_index<GroupKeyIndex>({ColumnID{1}});
+  EXPECT_EQ(chunk.get_indexes({ColumnID{1}}), std::vector<std::shared_ptr<BaseIndex>>{index});
+  EXPECT_EQ(chunk.get_indexes().size(), 1u);
+
+  // both columns contain the same segment, so the index also matches the first column
+  EXPECT_EQ(chunk.get_indexes({ColumnID{0}}).size(), 1u);
+  EXPECT_TRUE(chunk.get_indexes({ColumnID{0}, ColumnID{1}}).empty());
+
+  chunk.remove_index(index);
+  EXPECT_TRUE(chunk.get_indexes().empty());
+}
+
+TEST_F(GroupKeyIndexTest, ThrowsOnUnsupportedSegments) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  value_segment->append(1);
+  EXPECT_THROW(GroupKeyIndex({value_segment}), std::logic_error);
+  EXPECT_THROW(GroupKeyIndex({_dictionary_segment, _dictionary_segment}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,129 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({4, "d"});
+    _table->append({2, "b"});
+    _table->append({4, "d"});
+    _table->append({1, "a"});
+    _table->append({3, "c"});
+    _table->append({5, "e"});
+    _table->append({6, "f"});
+
+    // chunk 0 and 1 are dictionary-encoded, chunk 2 is not
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  template <typename T>
+  std::vector<std::pair<T, ChunkOffset>> _iterate(const BaseSegment& segment) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      result.emplace_back(position.value(), position.chunk_offset());
+    });
+    return result;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SegmentIterablesTest, ValueSegment) {
+  const auto segment = _table->get_chunk(ChunkID{2}).get_segment(ColumnID{1});
+  const auto expected = std::vector<std::pair<std::string, ChunkOffset>>{{"f", 0u}};
+  EXPECT_EQ(_iterate<std::string>(*segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, DictionarySegment) {
+  const auto segment = _table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto expected = std::vector<std::pair<int32_t, ChunkOffset>>{{4, 0u}, {2, 1u}, {4, 2u}};
+  EXPECT_EQ(_iterate<int32_t>(*segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, WideDictionarySegment) {
+  // 2^16 + 1 distinct values require value ids with 32 bits
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  const auto row_count = (1 << 16) + 1;
+  for (auto value = row_count - 1; value >= 0; --value) value_segment->append(value);
+  const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+
+  auto expected_offset = ChunkOffset{0};
+  auto all_match = true;
+  segment_iterate<int32_t>(dictionary_segment, [&](const auto& position) {
+    all_match &= position.chunk_offset() == expected_offset;
+    all_match &= position.value() == row_count - 1 - static_cast<int32_t>(expected_offset);
+    ++expected_offset;
+  });
+  EXPECT_TRUE(all_match);
+  EXPECT_EQ(expected_offset, static_cast<ChunkOffset>(row_count));
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegmentAcrossChunks) {
+  // references dictionary segments of chunks 0 and 1 as well as the value segment of chunk 2, out of order
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {{ChunkID{2}, 0}, {ChunkID{0}, 1}, {ChunkID{1}, 2}, {ChunkID{1}, 0}, {ChunkID{0}, 1}}));
+  const auto segment = ReferenceSegment{_table, ColumnID{1}, pos_list};
+
+  const auto expected =
+      std::vector<std::pair<std::string, ChunkOffset>>{{"f", 0u}, {"b", 1u}, {"e", 2u}, {"a", 3u}, {"b", 4u}};
+  EXPECT_EQ(_iterate<std::string>(segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegmentToSingleChunk) {
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{1}, 0}, {ChunkID{1}, 2}}));
+  pos_list->guarantee_single_chunk();
+  const auto dictionary_reference_segment = ReferenceSegment{_table, ColumnID{1}, pos_list};
+
+  const auto expected_dictionary = std::vector<std::pair<std::string, ChunkOffset>>{{"a", 0u}, {"e", 1u}};
+  EXPECT_EQ(_iterate<std::string>(dictionary_reference_segment), expected_dictionary);
+
+  auto value_pos_list = std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{2}, 0}, {ChunkID{2}, 0}}));
+  value_pos_list->guarantee_single_chunk();
+  const auto value_reference_segment = ReferenceSegment{_table, ColumnID{0}, value_pos_list};
+
+  const auto expected_values = std::vector<std::pair<int32_t, ChunkOffset>>{{6, 0u}, {6, 1u}};
+  EXPECT_EQ(_iterate<int32_t>(value_reference_segment), expected_values);
+}
+
+TEST_F(SegmentIterablesTest, WithIterators) {
+  const auto pos_list =
+      std::make_shared<PosList>(std::initializer_list<RowID>({{ChunkID{0}, 2}, {ChunkID{1}, 1}, {ChunkID{2}, 0}}));
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, pos_list};
+
+  auto sum = int32_t{0};
+  auto distance = std::ptrdiff_t{0};
+  segment_with_iterators<int32_t>(segment, [&](auto it, const auto end) {
+    distance = std::distance(it, end);
+    for (; it != end; ++it) {
+      sum += it->value();
+    }
+  });
+
+  EXPECT_EQ(distance, 3);
+  EXPECT_EQ(sum, 4 + 3 + 6);
+}
+
+TEST_F(SegmentIterablesTest, ThrowsOnTypeMismatch) {
+  const auto segment = _table->get_chunk(ChunkID{2}).get_segment(ColumnID{0});
+  EXPECT_THROW(segment_iterate<float>(*segment, [](const auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -66,6 +67,19 @@ TEST_F(StorageStorageManagerTest, TablesNamesIsCorrect) {
   EXPECT_EQ(table_names.at(1), "second_table");
 }
 
+TEST_F(StorageStorageManagerTest, TableNameOfInstance) {
+  auto& sm = StorageManager::get();
+  const auto t1 = sm.get_table("first_table");
+  EXPECT_EQ(sm.table_name(*t1), "first_table");
+  EXPECT_EQ(sm.table_name(Table{}), std::nullopt);
+
+  sm.add_table("alias", t1);
+  sm.drop_table("first_table");
+  EXPECT_EQ(sm.table_name(*t1), "alias");
+  sm.drop_table("alias");
+  EXPECT_EQ(sm.table_name(*t1), std::nullopt);
+}
+
 TEST_F(StorageStorageManagerTest, TablePrintIsCorrect) {
   auto& sm = StorageManager::get();
   std::stringstream stream;
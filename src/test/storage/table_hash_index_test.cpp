@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/scheduler/topology.hpp"
+#include "../lib/storage/index/table_hash/table_hash_index.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class TableHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("id", "int");
+    _table->add_column("name", "string");
+    for (auto id = 0; id < 7; ++id) {
+      _table->append({id, "name" + std::to_string(id % 3)});
+    }
+  }
+
+  static PosList _sorted_lookup(const BaseTableHashIndex& hash_index, const AllTypeVariant& value) {
+    auto pos_list = hash_index.lookup(value);
+    std::sort(pos_list.begin(), pos_list.end());
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableHashIndexTest, CreatedForExistingRows) {
+  const auto hash_index = _table->create_hash_index(ColumnID{0});
+  EXPECT_EQ(hash_index->size(), 7u);
+  EXPECT_EQ(_sorted_lookup(*hash_index, 4), (PosList{RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(_sorted_lookup(*hash_index, 6), (PosList{RowID{ChunkID{2}, 0}}));
+  EXPECT_TRUE(hash_index->lookup(7).empty());
+
+  EXPECT_EQ(_table->get_hash_index(ColumnID{0}), hash_index);
+  EXPECT_EQ(_table->create_hash_index(ColumnID{0}), hash_index);
+  EXPECT_EQ(_table->get_hash_index(ColumnID{1}), nullptr);
+}
+
+TEST_F(TableHashIndexTest, DuplicateValues) {
+  const auto hash_index = _table->create_hash_index(ColumnID{1});
+  EXPECT_EQ(_sorted_lookup(*hash_index, "name1"), (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+}
+
+TEST_F(TableHashIndexTest, MaintainedOnAppendAndCompression) {
+  const auto hash_index = _table->create_hash_index(ColumnID{0});
+
+  // fills chunk 2 and starts chunk 3
+  _table->append({7, "name7"});
+  _table->append({8, "name8"});
+  _table->append({9, "name9"});
+  EXPECT_EQ(hash_index->size(), 10u);
+  EXPECT_EQ(_sorted_lookup(*hash_index, 8), (PosList{RowID{ChunkID{2}, 2}}));
+  EXPECT_EQ(_sorted_lookup(*hash_index, 9), (PosList{RowID{ChunkID{3}, 0}}));
+
+  // RowIDs stay valid when chunks are compressed
+  _table->compress_chunk(ChunkID{1});
+  _table->compress_chunk(ChunkID{2});
+  for (auto id = 0; id < 10; ++id) {
+    const auto pos_list = hash_index->lookup(id);
+    ASSERT_EQ(pos_list.size(), 1u);
+    const auto& chunk = _table->get_chunk(pos_list.front().chunk_id);
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[pos_list.front().chunk_offset], AllTypeVariant{id});
+  }
+
+  _table->remove_hash_index(ColumnID{0});
+  EXPECT_EQ(_table->get_hash_index(ColumnID{0}), nullptr);
+}
+
+TEST_F(TableHashIndexTest, MaintainedOnEmplaceChunk) {
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("id", "int");
+  const auto hash_index = table->create_hash_index(ColumnID{0});
+
+  for (const auto first_id : {10, 20}) {
+    auto segment = std::make_shared<ValueSegment<int32_t>>();
+    segment->append(first_id);
+    segment->append(first_id + 1);
+    Chunk chunk;
+    chunk.add_segment(segment);
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  EXPECT_EQ(_sorted_lookup(*hash_index, 11), (PosList{RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(_sorted_lookup(*hash_index, 20), (PosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(TableHashIndexTest, UsedByTableScan) {
+  _table->compress_chunk(ChunkID{0});
+  auto wrapper = std::make_shared<TableWrapper>(_table);
+  wrapper->execute();
+
+  auto expected_scan = std::make_shared<TableScan>(wrapper, ColumnID{1}, ScanType::OpEquals, "name2");
+  expected_scan->execute();
+
+  // Output chunks keep the nodes of their input chunks, which differ from the round-robin assignment here
+  Topology::get().use_fake_numa_topology(2, 1);
+  _table->set_chunk_node_affinity([](const ChunkID chunk_id) { return NodeID{chunk_id % 2 == 0 ? 1u : 0u}; });
+
+  _table->create_hash_index(ColumnID{1});
+  auto scan = std::make_shared<TableScan>(wrapper, ColumnID{1}, ScanType::OpEquals, "name2");
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), expected_scan->get_output(), true);
+  ASSERT_EQ(scan->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0}).node_id(), 1u);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{1}).node_id(), 0u);
+
+  auto empty_scan = std::make_shared<TableScan>(wrapper, ColumnID{1}, ScanType::OpEquals, "name3");
+  empty_scan->execute();
+  EXPECT_EQ(empty_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_scan->get_output()->column_count(), 2u);
+}
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/scheduler/topology.hpp"
 #include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/storage/table.hpp"
 #include "../lib/types.hpp"
@@ -209,4 +210,38 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_THROW(t.compress_chunk(ChunkID{t.chunk_count() - 1}), std::exception);
 }
 
+TEST_F(StorageTableTest, ChunkNodeAffinity) {
+  Topology::get().use_fake_numa_topology(3, 1);
+
+  Table table{1};
+  table.add_column("a", "int");
+  for (auto value = 0; value < 5; ++value) {
+    table.append({value});
+  }
+
+  // round-robin by default
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table.get_chunk(chunk_id).node_id(), chunk_id % 3);
+  }
+
+  // Compressed chunks keep their node, as do chunks that were assigned to a node already
+  table.compress_chunk(ChunkID{1});
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).node_id(), 1u);
+
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  segment->append(5);
+  Chunk assigned_chunk;
+  assigned_chunk.add_segment(segment);
+  assigned_chunk.set_node_id(NodeID{2});
+  table.emplace_chunk(std::move(assigned_chunk));
+  EXPECT_EQ(table.get_chunk(ChunkID{5}).node_id(), 2u);
+
+  table.set_chunk_node_affinity([](const ChunkID chunk_id) { return chunk_id < 3 ? NodeID{0} : NodeID{1}; });
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).node_id(), 0u);
+  EXPECT_EQ(table.get_chunk(ChunkID{5}).node_id(), 1u);
+
+  table.append({6});
+  EXPECT_EQ(table.get_chunk(ChunkID{6}).node_id(), 1u);
+}
+
 }  // namespace opossum
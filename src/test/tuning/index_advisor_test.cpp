@@ -0,0 +1,149 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/index/b_tree/b_tree_index.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/tuning/index_advisor.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class IndexAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // four chunks, the first three of which are compressed
+    _table = std::make_shared<Table>(1000);
+    _table->add_column("id", "int");
+    _table->add_column("customer", "int");
+    _table->add_column("status", "string");
+    for (auto id = 0; id < 3500; ++id) {
+      _table->append({id, id % 700, id % 2 == 0 ? "open" : "closed"});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < 3; ++chunk_id) {
+      _table->compress_chunk(chunk_id);
+    }
+    StorageManager::get().add_table("orders", _table);
+  }
+
+  static void _scan(const ColumnID column_id, const AllTypeVariant& search_value, const size_t repetitions = 3) {
+    for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+      auto get_table = std::make_shared<GetTable>("orders");
+      get_table->execute();
+      auto scan = std::make_shared<TableScan>(get_table, column_id, ScanType::OpEquals, search_value);
+      scan->execute();
+    }
+  }
+
+  // returns the number of chunks with an index of type Index on column_id
+  template <typename Index>
+  size_t _indexed_chunk_count(const ColumnID column_id) const {
+    auto count = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      for (const auto& index : _table->get_chunk(chunk_id).get_indexes({column_id})) {
+        count += std::dynamic_pointer_cast<Index>(index) != nullptr;
+      }
+    }
+    return count;
+  }
+
+  static constexpr auto LARGE_BUDGET = size_t{1'000'000};
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(IndexAdvisorTest, RecordsPredicates) {
+  _scan(ColumnID{0}, 42, 1);
+  _scan(ColumnID{2}, "open", 1);
+  _scan(ColumnID{0}, 43, 2);
+
+  // The scans are summed up per column
+  const auto statistics = IndexAdvisor::get().predicate_statistics();
+  ASSERT_EQ(statistics.size(), 2u);
+  EXPECT_EQ(statistics[0].table_name, "orders");
+  EXPECT_EQ(statistics[0].column_id, ColumnID{0});
+  EXPECT_EQ(statistics[0].scan_count, 3u);
+  EXPECT_EQ(statistics[0].selective_scan_count, 3u);
+  EXPECT_EQ(statistics[0].skippable_row_count, 3u * 3499u);
+  EXPECT_GT(statistics[0].runtime.count(), 0);
+  EXPECT_EQ(statistics[1].column_id, ColumnID{2});
+  EXPECT_EQ(statistics[1].scan_count, 1u);
+  EXPECT_EQ(statistics[1].selective_scan_count, 0u);
+  EXPECT_EQ(statistics[1].skippable_row_count, 0u);
+
+  // Scans of tables that are not in the StorageManager are not recorded
+  auto wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  wrapper->execute();
+  auto scan = std::make_shared<TableScan>(wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  scan->execute();
+  EXPECT_EQ(IndexAdvisor::get().predicate_statistics().size(), 2u);
+}
+
+TEST_F(IndexAdvisorTest, RecommendsSelectiveColumns) {
+  _scan(ColumnID{0}, 42);
+  _scan(ColumnID{2}, "open");
+
+  const auto recommendations = IndexAdvisor::get().recommend(LARGE_BUDGET);
+  ASSERT_EQ(recommendations.size(), 1u);
+  EXPECT_EQ(recommendations[0].table_name, "orders");
+  EXPECT_EQ(recommendations[0].column_id, ColumnID{0});
+  EXPECT_GT(recommendations[0].benefit, 0.0);
+  EXPECT_GT(recommendations[0].memory_usage, 0u);
+
+  EXPECT_TRUE(IndexAdvisor::get().recommend(recommendations[0].memory_usage - 1).empty());
+}
+
+TEST_F(IndexAdvisorTest, CreatesIndexes) {
+  _scan(ColumnID{0}, 42);
+  IndexAdvisor::get().tune(LARGE_BUDGET);
+
+  EXPECT_TRUE(IndexAdvisor::get().predicate_statistics().empty());
+  EXPECT_EQ(_indexed_chunk_count<GroupKeyIndex>(ColumnID{0}), 3u);
+  EXPECT_EQ(_indexed_chunk_count<BTreeIndex>(ColumnID{0}), 1u);
+
+  // The index on the uncompressed chunk is maintained on append
+  for (auto id = 3500; id < 4000; ++id) {
+    _table->append({id, id % 700, "closed"});
+  }
+  auto get_table = std::make_shared<GetTable>("orders");
+  get_table->execute();
+  auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpEquals, 3500);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+
+  // Tuning again does not create further indexes, but replaces those of replaced chunks
+  _scan(ColumnID{0}, 43);
+  _table->compress_chunk(ChunkID{3});
+  IndexAdvisor::get().tune(LARGE_BUDGET);
+  EXPECT_EQ(_indexed_chunk_count<GroupKeyIndex>(ColumnID{0}), 4u);
+  EXPECT_EQ(_indexed_chunk_count<BTreeIndex>(ColumnID{0}), 0u);
+}
+
+TEST_F(IndexAdvisorTest, DropsIndexesWhenWorkloadShifts) {
+  // An index that was not created by the advisor is kept
+  _table->get_chunk(ChunkID{0}).create_index<BTreeIndex>({ColumnID{0}});
+
+  _scan(ColumnID{0}, 42);
+  const auto budget = IndexAdvisor::get().recommend(LARGE_BUDGET).front().memory_usage;
+  IndexAdvisor::get().tune(budget);
+  EXPECT_EQ(_indexed_chunk_count<GroupKeyIndex>(ColumnID{0}), 2u);
+
+  // The benefit of the id column decays, the customer column is filtered now and only one of them fits
+  _scan(ColumnID{1}, 7);
+  const auto recommendations = IndexAdvisor::get().tune(budget);
+  ASSERT_EQ(recommendations.size(), 1u);
+  EXPECT_EQ(recommendations[0].column_id, ColumnID{1});
+  EXPECT_EQ(_indexed_chunk_count<GroupKeyIndex>(ColumnID{0}), 0u);
+  EXPECT_EQ(_indexed_chunk_count<BTreeIndex>(ColumnID{0}), 1u);
+  EXPECT_EQ(_indexed_chunk_count<GroupKeyIndex>(ColumnID{1}), 3u);
+}
+
+}  // namespace opossum